@@ -0,0 +1,116 @@
+#include "reaction/reaction.h"
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Count every allocation of the process; built with REACTION_ALLOC_TRACKING=1
+REACTION_DEFINE_TRACKING_OPERATOR_NEW()
+
+using namespace reaction;
+
+struct Measurement {
+    const char *label = "";
+    double allocations = 0.0;
+    double bytes = 0.0;
+    AllocCounts bySubsystem[ALLOC_SUBSYSTEM_COUNT]{};
+};
+
+// Run an operation repeatedly and report the allocations of one run
+template <typename F>
+Measurement measure(const char *label, size_t runs, F &&operation) {
+    auto &tracker = AllocTracker::getInstance();
+    tracker.reset();
+    for (size_t i = 0; i < runs; ++i) {
+        operation(i);
+    }
+    Measurement result;
+    result.label = label;
+    AllocCounts total = tracker.total();
+    result.allocations = static_cast<double>(total.allocations) / runs;
+    result.bytes = static_cast<double>(total.bytes) / runs;
+    for (size_t s = 0; s < ALLOC_SUBSYSTEM_COUNT; ++s) {
+        result.bySubsystem[s] = tracker.snapshot(static_cast<AllocSubsystem>(s));
+    }
+    return result;
+}
+
+void print(const Measurement &m, size_t runs) {
+    std::cout << std::left << std::setw(30) << m.label << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << m.allocations << " allocs" << std::setw(12) << m.bytes << " bytes   ";
+    for (size_t s = 0; s < ALLOC_SUBSYSTEM_COUNT; ++s) {
+        if (m.bySubsystem[s].allocations > 0) {
+            std::cout << " " << allocSubsystemName(static_cast<AllocSubsystem>(s)) << "="
+                      << std::setprecision(2) << static_cast<double>(m.bySubsystem[s].allocations) / runs;
+        }
+    }
+    std::cout << std::endl;
+}
+
+// Source feeding a chain of calcs and a fan-out of calcs, ending in actions
+struct Graph {
+    Var<int> source = var(0);
+    std::vector<Calc<int>> chain;
+    std::vector<Calc<int>> fanOut;
+    std::vector<Action<>> sinks;
+    long sum = 0;
+
+    Graph() {
+        chain.reserve(8);
+        fanOut.reserve(8);
+        chain.push_back(calc([this]() { return source() + 1; }));
+        for (int i = 1; i < 8; ++i) {
+            auto &prev = chain.back();
+            chain.push_back(calc([&prev]() { return prev() + 1; }));
+        }
+        for (int i = 0; i < 8; ++i) {
+            fanOut.push_back(calc([this, i]() { return source() * i; }));
+            sinks.push_back(action([this, i]() { sum += fanOut[i](); }));
+        }
+    }
+};
+
+int main() {
+    std::cout << "🧮 REACTION ALLOCATION BENCHMARK 🧮" << std::endl;
+    std::cout << std::string(100, '=') << std::endl;
+    if (!AllocTracker::ENABLED) {
+        std::cout << "Built without REACTION_ALLOC_TRACKING; subsystem breakdown unavailable" << std::endl;
+    }
+
+    const size_t runs = 1000;
+    std::vector<Measurement> results;
+    {
+        Graph graph;
+        results.push_back(measure("write (single-threaded)", runs, [&](size_t i) {
+            graph.source.value(static_cast<int>(i) + 1);
+        }));
+        results.push_back(measure("batch of 4 writes", runs, [&](size_t i) {
+            batchExecute([&]() {
+                for (int w = 0; w < 4; ++w) {
+                    graph.source.value(static_cast<int>(i * 4) + w);
+                }
+            });
+        }));
+        ThreadManager::getInstance().enableThreadSafety();
+        results.push_back(measure("write (thread-safe)", runs, [&](size_t i) {
+            graph.source.value(static_cast<int>(i) + 1);
+        }));
+    }
+    std::vector<Var<int>> vars;
+    std::vector<Calc<int>> calcs;
+    vars.reserve(runs);
+    calcs.reserve(runs);
+    results.push_back(measure("var creation", runs, [&](size_t i) {
+        vars.push_back(var(static_cast<int>(i)));
+    }));
+    results.push_back(measure("calc creation", runs, [&](size_t i) {
+        auto &input = vars[i];
+        calcs.push_back(calc([&input]() { return input() * 2; }));
+    }));
+
+    std::cout << "Per operation, graph of 1 var, 16 calcs and 8 actions:" << std::endl;
+    for (const auto &result : results) {
+        print(result, runs);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "perf_counter.h"
+#include "reaction/reaction.h"
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace reaction;
+
+// Distinct value type per index, so every chain instantiates its own node templates
+template <int I>
+struct Value {
+    int v = 0;
+    bool operator==(const Value &) const = default;
+};
+
+constexpr int TYPE_COUNT = 48;
+
+// One source, one calc and one action per value type, driven through a type-erased step
+template <int I>
+struct Chain {
+    Var<Value<I>> source = var(Value<I>{});
+    Calc<Value<I>> doubled = calc([this]() { return Value<I>{source().v * 2}; });
+    Action<> sink = action([this]() { sum += doubled().v; });
+    long sum = 0;
+
+    static void step(void *chain, int value) {
+        static_cast<Chain *>(chain)->source.value(Value<I>{value});
+    }
+};
+
+struct RunResult {
+    double ms = 0.0;
+    std::optional<uint64_t> misses;
+};
+
+template <int... I>
+RunResult run(std::integer_sequence<int, I...>, size_t rounds) {
+    std::tuple<Chain<I>...> chains;
+    std::vector<std::pair<void *, void (*)(void *, int)>> steps{{&std::get<I>(chains), &Chain<I>::step}...};
+
+    PerfCounter counter(PerfEvent::ICACHE_MISSES);
+    auto start = std::chrono::high_resolution_clock::now();
+    counter.start();
+    // Interleave the types so each update runs different instantiations than the last
+    for (size_t r = 0; r < rounds; ++r) {
+        for (auto [chain, step] : steps) {
+            step(chain, static_cast<int>(r));
+        }
+    }
+    RunResult result;
+    result.misses = counter.stop();
+    auto end = std::chrono::high_resolution_clock::now();
+    result.ms = std::chrono::duration<double, std::milli>(end - start).count();
+    return result;
+}
+
+int main() {
+    std::cout << "📦 REACTION CODE SIZE BENCHMARK 📦" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    std::error_code error;
+    auto binary = std::filesystem::file_size("/proc/self/exe", error);
+    if (!error) {
+        std::cout << "Binary size: " << binary / 1024 << " KiB for " << TYPE_COUNT << " value types" << std::endl;
+    }
+
+    const size_t rounds = 2000;
+    const size_t updates = rounds * TYPE_COUNT;
+    run(std::make_integer_sequence<int, TYPE_COUNT>{}, 10); // warm up
+    RunResult result = run(std::make_integer_sequence<int, TYPE_COUNT>{}, rounds);
+
+    std::cout << std::fixed << std::setprecision(2) << "Propagation: " << result.ms << " ms for " << updates
+              << " updates (" << std::setprecision(0) << result.ms * 1e6 / updates << " ns per update)" << std::endl;
+    if (result.misses) {
+        std::cout << "I-cache misses: " << *result.misses << " (" << std::setprecision(1)
+                  << static_cast<double>(*result.misses) / updates << " per update)" << std::endl;
+    } else {
+        std::cout << "I-cache misses unavailable" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include "perf_counter.h"
+#include "reaction/reaction.h"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace reaction;
+
+struct RunResult {
+    double ms = 0.0;
+    std::optional<uint64_t> misses;
+};
+
+// Layered fan-out tree whose nodes are allocated in shuffled order between filler blocks,
+// so that neighbouring nodes end up far apart on the heap
+class ScatteredGraph {
+public:
+    ScatteredGraph(size_t width, size_t depth) : m_root(create(1)) {
+        std::mt19937 rng(42);
+        m_layers.resize(depth);
+        for (auto &layer : m_layers) {
+            layer.reserve(width);
+        }
+        for (size_t l = 0; l < depth; ++l) {
+            std::vector<size_t> order(width);
+            for (size_t i = 0; i < width; ++i) order[i] = i;
+            std::shuffle(order.begin(), order.end(), rng);
+
+            std::vector<std::optional<Calc<int>>> slots(width);
+            for (size_t i : order) {
+                m_filler.push_back(std::make_unique<char[]>(64 + rng() % 512));
+                if (l == 0) {
+                    slots[i] = create([this, i]() { return m_root() + static_cast<int>(i); });
+                } else {
+                    size_t parent = rng() % width;
+                    auto &prev = m_layers[l - 1];
+                    slots[i] = create([&prev, parent, i]() { return prev[parent]() + static_cast<int>(i); });
+                }
+            }
+            for (auto &slot : slots) {
+                m_layers[l].push_back(std::move(*slot));
+            }
+        }
+    }
+
+    RunResult run(size_t iterations) {
+        PerfCounter counter(PerfEvent::CACHE_MISSES);
+        auto start = std::chrono::high_resolution_clock::now();
+        counter.start();
+        for (size_t i = 0; i < iterations; ++i) {
+            m_root.value(static_cast<int>(i));
+        }
+        RunResult result;
+        result.misses = counter.stop();
+        auto end = std::chrono::high_resolution_clock::now();
+        result.ms = std::chrono::duration<double, std::milli>(end - start).count();
+        return result;
+    }
+
+    // Same updates through one reused batch, whose cone walk uses the dirty bitmap once compacted
+    RunResult runBatch(size_t iterations) {
+        int next = 0;
+        auto update = batch([this, &next]() { m_root.value(next); });
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            next = static_cast<int>(i);
+            update.execute();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        RunResult result;
+        result.ms = std::chrono::duration<double, std::milli>(end - start).count();
+        return result;
+    }
+
+private:
+    Var<int> m_root;
+    std::vector<std::vector<Calc<int>>> m_layers;
+    std::vector<std::unique_ptr<char[]>> m_filler;
+};
+
+void print(const char *label, const RunResult &result, size_t iterations) {
+    std::cout << std::left << std::setw(18) << label << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << result.ms << " ms";
+    if (result.misses) {
+        std::cout << std::setw(14) << *result.misses << " cache misses ("
+                  << std::setprecision(1) << static_cast<double>(*result.misses) / iterations << " per update)";
+    } else {
+        std::cout << "   cache misses unavailable";
+    }
+    std::cout << std::endl;
+}
+
+int main() {
+    std::cout << "🧱 REACTION COMPACT TOPOLOGY BENCHMARK 🧱" << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+
+    const size_t width = 256;
+    const size_t depth = 16;
+    const size_t iterations = 200;
+    ScatteredGraph graph(width, depth);
+    std::cout << "Graph: " << width * depth + 1 << " nodes, " << iterations << " root updates" << std::endl;
+
+    graph.run(10); // warm up
+    RunResult before = graph.run(iterations);
+    RunResult batchBefore = graph.runBatch(iterations);
+    size_t nodes = compact();
+    graph.run(10);
+    RunResult after = graph.run(iterations);
+    RunResult batchAfter = graph.runBatch(iterations);
+
+    std::cout << "Compacted " << nodes << " nodes" << std::endl;
+    print("Before compact():", before, iterations);
+    print("After compact():", after, iterations);
+    std::cout << std::fixed << std::setprecision(2) << "Speedup: " << before.ms / after.ms << "x" << std::endl;
+    if (before.misses && after.misses && *after.misses > 0) {
+        std::cout << "Cache miss reduction: " << static_cast<double>(*before.misses) / *after.misses << "x" << std::endl;
+    }
+    std::cout << std::fixed << std::setprecision(2) << "Batched updates: " << batchBefore.ms << " ms before, "
+              << batchAfter.ms << " ms after (" << batchBefore.ms / batchAfter.ms << "x)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+/**
+ * @file expected_example.cpp
+ * @brief Exception-free error propagation example of the Reaction framework
+ *
+ * This example demonstrates:
+ * - Error-valued nodes using Expected<T>
+ * - Errors flowing downstream as values instead of exceptions
+ * - Recovery as soon as the failing input becomes valid again
+ *
+ * It is built with exceptions disabled (-fno-exceptions where supported).
+ *
+ * Use case: A pricing chain that must keep running when one quote goes bad
+ */
+
+#include <iostream>
+#include <reaction/reaction.h>
+
+using namespace reaction;
+
+namespace {
+
+Expected<double> parseQuote(double raw) {
+    if (raw <= 0) {
+        return Error{ReactionException::ErrorCode::INVALID_STATE, "non-positive quote"};
+    }
+    return raw;
+}
+
+void print(const char *label, const Expected<double> &value) {
+    if (value) {
+        std::cout << label << ": " << *value << "\n";
+    } else {
+        std::cout << label << ": error (" << value.error().message << ")\n";
+    }
+}
+
+} // namespace
+
+int main() {
+    std::cout << "Exceptions " << (REACTION_EXCEPTIONS ? "enabled" : "disabled") << "\n";
+
+    auto raw = var(101.5).setName("raw");
+    auto quote = calc([](double r) { return parseQuote(r); }, raw);
+    auto withFee = calc([](double q) { return q * 1.001; }, quote);
+    auto position = calc([](double p) { return p * 200; }, withFee);
+    auto report = action([](double p) { std::cout << "position value " << p << "\n"; }, position);
+
+    print("position", position.get());
+
+    raw.value(-3.0); // bad tick: the error travels downstream, report is skipped
+    print("position", position.get());
+
+    raw.value(99.0); // recovered
+    print("position", position.get());
+    return 0;
+}
@@ -11,6 +11,8 @@
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 #include <shared_mutex>
@@ -111,6 +113,18 @@ public:
         }
     };
 
+    /**
+     * @brief Allocate entries from another memory resource.
+     *
+     * Drops all current entries, which live in the previous resource.
+     * @param resource Resource for future entries; must outlive the cache.
+     */
+    void useMemoryResource(std::pmr::memory_resource *resource) noexcept {
+        std::unique_lock<std::shared_mutex> lock(m_cacheMutex);
+        std::destroy_at(&m_cacheEntries);
+        std::construct_at(&m_cacheEntries, resource);
+    }
+
 protected:
     /**
      * @brief Constructor with cache configuration.
@@ -235,7 +249,7 @@ private:
     const std::chrono::minutes m_cacheTTL;
 
     mutable std::shared_mutex m_cacheMutex;
-    mutable std::unordered_map<Key, CacheEntry, Hash, KeyEqual> m_cacheEntries;
+    mutable std::pmr::unordered_map<Key, CacheEntry, Hash, KeyEqual> m_cacheEntries;
     std::atomic<uint64_t> m_currentVersion{1};
 
     // Statistics tracking
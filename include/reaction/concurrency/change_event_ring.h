@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/concept.h"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace reaction {
+
+/**
+ * @brief A single node change event as seen by a ring consumer.
+ */
+struct ChangeEvent {
+    static constexpr size_t MAX_PAYLOAD = 48; ///< Largest value (in bytes) carried inline.
+
+    uint64_t nodeId = 0;                             ///< Id of the changed node.
+    uint64_t epoch = 0;                              ///< Change-feed epoch of the change.
+    uint32_t size = 0;                               ///< Number of valid payload bytes.
+    alignas(8) std::array<std::byte, MAX_PAYLOAD> payload{}; ///< Raw bytes of the new value.
+
+    /**
+     * @brief Reinterpret the payload as a value of type T.
+     * @tparam T Trivially copyable type that was published.
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    [[nodiscard]] T as() const noexcept {
+        T value;
+        std::memcpy(&value, payload.data(), sizeof(T));
+        return value;
+    }
+};
+
+/**
+ * @brief Checks whether a node value type can be published to a change-event ring.
+ */
+template <typename T>
+concept ChangeEventPayload = !VoidType<T> && std::is_trivially_copyable_v<T> && sizeof(T) <= ChangeEvent::MAX_PAYLOAD;
+
+/**
+ * @brief Pre-allocated single-producer, multi-consumer broadcast ring of change events.
+ *
+ * Modeled on the disruptor pattern: the producer (the propagation thread)
+ * claims the next sequence, writes the slot and publishes it without ever
+ * allocating or waiting for consumers. Every consumer owns a Cursor with its
+ * own sequence and reads slots through a per-slot sequence check, so slow
+ * consumers never hold back the producer; a consumer that falls more than one
+ * ring behind is told it was overrun and resumes at the oldest retained event.
+ *
+ * Only one thread may publish at a time.
+ */
+class ChangeEventRing {
+    static constexpr size_t PAYLOAD_WORDS = ChangeEvent::MAX_PAYLOAD / sizeof(uint64_t);
+    static constexpr uint64_t BUSY = ~uint64_t{0};
+
+    /**
+     * @brief Ring slot whose fields are accessed atomically so readers can validate copies.
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<uint64_t> nodeId{0};
+        std::atomic<uint64_t> epoch{0};
+        std::atomic<uint64_t> size{0};
+        std::array<std::atomic<uint64_t>, PAYLOAD_WORDS> payload{};
+    };
+
+public:
+    /**
+     * @brief Outcome of a consumer poll.
+     */
+    enum class PollStatus {
+        OK,      ///< An event was copied out.
+        EMPTY,   ///< No new event is available yet.
+        OVERRUN, ///< Events were overwritten before being read; the cursor was resynchronized.
+    };
+
+    /**
+     * @brief Per-consumer read position.
+     */
+    class Cursor {
+    public:
+        /**
+         * @brief Read the next event.
+         * @param out Receives the event when PollStatus::OK is returned.
+         * @return PollStatus Result of the poll.
+         */
+        PollStatus poll(ChangeEvent &out) noexcept {
+            const uint64_t head = m_ring->m_published.load(std::memory_order_acquire);
+            if (m_next > head) return PollStatus::EMPTY;
+            if (head - m_next >= m_ring->capacity()) {
+                return resync(head);
+            }
+
+            const Slot &slot = m_ring->slotFor(m_next);
+            if (slot.sequence.load(std::memory_order_acquire) != m_next) {
+                return resync(m_ring->m_published.load(std::memory_order_acquire));
+            }
+
+            // Acquire loads pair with the producer's release stores: if any field
+            // already belongs to a newer event, the sequence re-check below sees it
+            out.nodeId = slot.nodeId.load(std::memory_order_acquire);
+            out.epoch = slot.epoch.load(std::memory_order_acquire);
+            out.size = static_cast<uint32_t>(slot.size.load(std::memory_order_acquire));
+            std::array<uint64_t, PAYLOAD_WORDS> words;
+            for (size_t i = 0; i < PAYLOAD_WORDS; ++i) {
+                words[i] = slot.payload[i].load(std::memory_order_acquire);
+            }
+
+            // The producer lapped us while copying
+            if (slot.sequence.load(std::memory_order_relaxed) != m_next) {
+                return resync(m_ring->m_published.load(std::memory_order_acquire));
+            }
+
+            std::memcpy(out.payload.data(), words.data(), ChangeEvent::MAX_PAYLOAD);
+            ++m_next;
+            return PollStatus::OK;
+        }
+
+        /// @brief Sequence number of the next event this cursor will read.
+        [[nodiscard]] uint64_t sequence() const noexcept {
+            return m_next;
+        }
+
+        /// @brief Total number of events this cursor lost to overruns.
+        [[nodiscard]] uint64_t missed() const noexcept {
+            return m_missed;
+        }
+
+    private:
+        friend class ChangeEventRing;
+
+        Cursor(const ChangeEventRing &ring, uint64_t next) noexcept : m_ring(&ring), m_next(next) {}
+
+        /**
+         * @brief Skip to the oldest event still retained by the ring.
+         */
+        PollStatus resync(uint64_t head) noexcept {
+            const uint64_t oldest = head >= m_ring->capacity() ? head - m_ring->capacity() + 2 : 1;
+            if (oldest > m_next) {
+                m_missed += oldest - m_next;
+                m_next = oldest;
+            }
+            return PollStatus::OVERRUN;
+        }
+
+        const ChangeEventRing *m_ring; ///< Ring being consumed.
+        uint64_t m_next;               ///< Next sequence to read.
+        uint64_t m_missed{0};          ///< Events lost to overruns.
+    };
+
+    /**
+     * @brief Construct a ring with room for at least the given number of events.
+     * @param capacity Requested capacity, rounded up to a power of two.
+     */
+    explicit ChangeEventRing(size_t capacity)
+        : m_mask(std::bit_ceil(capacity < 2 ? size_t{2} : capacity) - 1),
+          m_slots(std::make_unique<Slot[]>(m_mask + 1)) {
+    }
+
+    /// @brief Detaches the ring from the graph if it is still attached.
+    ~ChangeEventRing() {
+        detach();
+    }
+
+    ChangeEventRing(const ChangeEventRing &) = delete;
+    ChangeEventRing &operator=(const ChangeEventRing &) = delete;
+
+    /// @brief Number of events retained by the ring.
+    [[nodiscard]] size_t capacity() const noexcept {
+        return m_mask + 1;
+    }
+
+    /// @brief Sequence number of the most recently published event (0 if none).
+    [[nodiscard]] uint64_t published() const noexcept {
+        return m_published.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Create a consumer cursor positioned after the latest published event.
+     * @return Cursor New consumer cursor.
+     */
+    [[nodiscard]] Cursor subscribe() const noexcept {
+        return Cursor{*this, published() + 1};
+    }
+
+    /**
+     * @brief Publish an event. Producer side, never allocates or blocks.
+     *
+     * @param nodeId Id of the changed node.
+     * @param epoch Change-feed epoch of the change.
+     * @param data Pointer to the value bytes.
+     * @param size Number of value bytes, at most ChangeEvent::MAX_PAYLOAD.
+     * @return false if the value was too large and the event was dropped.
+     */
+    bool publish(uint64_t nodeId, uint64_t epoch, const void *data, size_t size) noexcept {
+        if (size > ChangeEvent::MAX_PAYLOAD) [[unlikely]] return false;
+
+        std::array<uint64_t, PAYLOAD_WORDS> words{};
+        std::memcpy(words.data(), data, size);
+
+        const uint64_t sequence = m_published.load(std::memory_order_relaxed) + 1;
+        Slot &slot = slotFor(sequence);
+        slot.sequence.store(BUSY, std::memory_order_relaxed);
+
+        slot.nodeId.store(nodeId, std::memory_order_release);
+        slot.epoch.store(epoch, std::memory_order_release);
+        slot.size.store(size, std::memory_order_release);
+        for (size_t i = 0; i < PAYLOAD_WORDS; ++i) {
+            slot.payload[i].store(words[i], std::memory_order_release);
+        }
+
+        slot.sequence.store(sequence, std::memory_order_release);
+        m_published.store(sequence, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Start receiving change events from every reactive node.
+     */
+    void attach() noexcept;
+
+    /**
+     * @brief Stop receiving change events if this ring is the attached one.
+     */
+    void detach() noexcept;
+
+private:
+    [[nodiscard]] Slot &slotFor(uint64_t sequence) noexcept {
+        return m_slots[sequence & m_mask];
+    }
+
+    [[nodiscard]] const Slot &slotFor(uint64_t sequence) const noexcept {
+        return m_slots[sequence & m_mask];
+    }
+
+    const size_t m_mask;                                 ///< Capacity - 1, capacity is a power of two.
+    std::unique_ptr<Slot[]> m_slots;                     ///< Pre-allocated slots.
+    alignas(64) std::atomic<uint64_t> m_published{0};    ///< Last published sequence.
+};
+
+/**
+ * @brief Ring currently receiving change events, if any.
+ */
+inline std::atomic<ChangeEventRing *> g_change_event_ring{nullptr};
+
+inline void ChangeEventRing::attach() noexcept {
+    g_change_event_ring.store(this, std::memory_order_release);
+}
+
+inline void ChangeEventRing::detach() noexcept {
+    ChangeEventRing *expected = this;
+    g_change_event_ring.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Publish the current value of a node to the attached change-event ring.
+ *
+ * Compiles to nothing for value types that cannot be carried inline, and to a
+ * single atomic load when no ring is attached.
+ *
+ * @param node Reactive node whose value changed.
+ */
+template <typename Node>
+inline void publishChangeEvent(const Node &node) {
+    using Type = std::remove_cvref_t<decltype(node.getValue())>;
+    if constexpr (ChangeEventPayload<Type>) {
+        if (auto *ring = g_change_event_ring.load(std::memory_order_acquire)) [[unlikely]] {
+            const Type value = node.getValue();
+            ring->publish(node.getId(), node.getChangeEpoch(), &value, sizeof(Type));
+        }
+    }
+}
+
+} // namespace reaction
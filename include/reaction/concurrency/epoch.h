@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Epoch-based reclamation for data published to lock-free readers.
+ *
+ * Readers pin the current epoch for the duration of a traversal and may then
+ * dereference published pointers without locks or reference counting.
+ * Writers publish a replacement first and retire the old object afterwards;
+ * reclaim() releases a retired object once every reader that could still
+ * see it has left its epoch.
+ *
+ * Each thread owns one reader record, claimed on its first pin and handed
+ * back for reuse when the thread exits. Pinning nests: only the outermost
+ * pin of a thread publishes an epoch, inner pins just count.
+ */
+class EpochManager {
+    struct Reader;
+
+public:
+    /**
+     * @brief Get the singleton instance.
+     * @return EpochManager& Reference to the singleton instance.
+     */
+    static EpochManager &getInstance() noexcept {
+        static EpochManager instance;
+        return instance;
+    }
+
+    /**
+     * @brief RAII pin of the current epoch on the calling thread.
+     */
+    class Guard {
+    public:
+        Guard() : m_reader(EpochManager::getInstance().localReader()) {
+            if (m_reader.depth++ == 0) {
+                // seq_cst orders this store before the reader's loads of published pointers
+                m_reader.epoch.store(EpochManager::getInstance().m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+        }
+
+        ~Guard() {
+            if (--m_reader.depth == 0) {
+                m_reader.epoch.store(IDLE, std::memory_order_release);
+            }
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+    private:
+        Reader &m_reader;
+    };
+
+    /**
+     * @brief Retire an object that has already been unpublished.
+     *
+     * The object is kept alive until reclaim() finds no reader that pinned
+     * an epoch in which it was still reachable.
+     * @param object Object to release later.
+     */
+    void retire(std::shared_ptr<const void> object) {
+        if (!object) return;
+        // Readers that pinned before this increment may still hold the object
+        const uint64_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(m_retiredMutex);
+        m_retired.push_back({epoch, std::move(object)});
+        m_retiredCount.store(m_retired.size(), std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Release retired objects no reader can still reach.
+     *
+     * The objects are destroyed after the internal lock is dropped, so their
+     * destructors may publish, retire or take other locks; callers should
+     * not hold locks that such destructors need.
+     * @return size_t Number of objects released.
+     */
+    size_t reclaim() {
+        const uint64_t oldest = oldestPinnedEpoch();
+        std::vector<Retired> released;
+        {
+            std::lock_guard<std::mutex> lock(m_retiredMutex);
+            auto keep = m_retired.begin();
+            for (auto &retired : m_retired) {
+                if (retired.epoch < oldest) {
+                    released.push_back(std::move(retired));
+                } else {
+                    *keep++ = std::move(retired);
+                }
+            }
+            m_retired.erase(keep, m_retired.end());
+            m_retiredCount.store(m_retired.size(), std::memory_order_relaxed);
+        }
+        return released.size();
+    }
+
+    /// @brief Number of retired objects awaiting reclamation.
+    [[nodiscard]] size_t retiredCount() const noexcept {
+        return m_retiredCount.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Current global epoch.
+    [[nodiscard]] uint64_t epoch() const noexcept {
+        return m_epoch.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr uint64_t IDLE = 0; ///< Epoch value of a reader outside any pin.
+
+    /**
+     * @brief Per-thread reader record, on its own cache line.
+     */
+    struct alignas(64) Reader {
+        std::atomic<uint64_t> epoch{IDLE};  ///< Pinned epoch, IDLE when not pinned.
+        std::atomic<bool> claimed{false};   ///< Whether a live thread owns the record.
+        uint32_t depth = 0;                 ///< Pin nesting depth; owner thread only.
+        Reader *next = nullptr;             ///< Next record; immutable once linked.
+    };
+
+    /**
+     * @brief An unpublished object and the epoch it was retired in.
+     */
+    struct Retired {
+        uint64_t epoch;
+        std::shared_ptr<const void> object;
+    };
+
+    /**
+     * @brief Hands the calling thread's record back when the thread exits.
+     */
+    struct ReaderHandle {
+        Reader *reader = nullptr;
+
+        ~ReaderHandle() {
+            if (reader) {
+                reader->epoch.store(IDLE, std::memory_order_release);
+                reader->claimed.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    EpochManager() = default;
+    EpochManager(const EpochManager &) = delete;
+    EpochManager &operator=(const EpochManager &) = delete;
+
+    Reader &localReader() {
+        thread_local ReaderHandle handle;
+        if (!handle.reader) [[unlikely]] {
+            handle.reader = claimReader();
+        }
+        return *handle.reader;
+    }
+
+    Reader *claimReader() {
+        for (Reader *reader = m_readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+            bool expected = false;
+            if (!reader->claimed.load(std::memory_order_relaxed) &&
+                reader->claimed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+                return reader;
+            }
+        }
+        // Records live as long as the process, so traversals never see a freed one
+        auto *reader = new Reader;
+        reader->claimed.store(true, std::memory_order_relaxed);
+        reader->next = m_readers.load(std::memory_order_relaxed);
+        while (!m_readers.compare_exchange_weak(reader->next, reader, std::memory_order_acq_rel)) {
+        }
+        return reader;
+    }
+
+    uint64_t oldestPinnedEpoch() const noexcept {
+        uint64_t oldest = UINT64_MAX;
+        for (Reader *reader = m_readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+            const uint64_t epoch = reader->epoch.load(std::memory_order_seq_cst);
+            if (epoch != IDLE && epoch < oldest) oldest = epoch;
+        }
+        return oldest;
+    }
+
+    std::atomic<uint64_t> m_epoch{1};          ///< Global epoch; IDLE is never a valid epoch.
+    std::atomic<Reader *> m_readers{nullptr};  ///< Lock-free list of reader records.
+    mutable std::mutex m_retiredMutex;         ///< Protects m_retired.
+    std::vector<Retired> m_retired;            ///< Objects awaiting reclamation.
+    std::atomic<size_t> m_retiredCount{0};     ///< Size of m_retired, readable without the lock.
+};
+
+/// @brief Pin of the current epoch; see EpochManager.
+using EpochGuard = EpochManager::Guard;
+
+} // namespace reaction
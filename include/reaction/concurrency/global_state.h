@@ -8,15 +8,25 @@
 #pragma once
 
 #include "reaction/core/types.h"
+#include <atomic>
 #include <functional>
 
 namespace reaction {
 
+class GraphTransaction;
+struct CompactTopology;
+
 // === Thread-Local Global State Variables ===
 
 inline thread_local std::function<void(const NodePtr &)> g_reg_fun = nullptr;
 inline thread_local std::function<void(const NodePtr &)> g_batch_fun = nullptr;
 inline thread_local bool g_batch_execute = false;
+inline thread_local GraphTransaction *g_graph_transaction = nullptr; ///< Innermost open rebind transaction.
+inline thread_local const CompactTopology *g_compact_topology = nullptr; ///< Snapshot used by the running propagation.
+
+// === Process-Wide Global State Variables ===
+
+inline std::atomic<bool> g_sliced_propagation{false}; ///< Route value changes through PropagationScheduler.
 
 // === Generic ScopedValue ===
 
@@ -63,6 +73,11 @@ struct BatchExeGuard : ScopedValue<bool> {
         : ScopedValue(g_batch_execute, flag) {}
 };
 
+struct CompactTopologyGuard : ScopedValue<const CompactTopology *> {
+    explicit CompactTopologyGuard(const CompactTopology *topology)
+        : ScopedValue(g_compact_topology, topology) {}
+};
+
 // === Global State Query Functions ===
 
 [[nodiscard]] inline bool isDependencyTrackingActive() noexcept {
@@ -83,6 +98,8 @@ inline void resetGlobalState() noexcept {
     g_reg_fun = nullptr;
     g_batch_fun = nullptr;
     g_batch_execute = false;
+    g_graph_transaction = nullptr;
+    g_compact_topology = nullptr;
 }
 
 } // namespace reaction
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Compile-time switch for lock contention instrumentation
+#ifndef REACTION_LOCK_STATS
+#define REACTION_LOCK_STATS 0
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Classes of locks whose contention is reported separately.
+ */
+enum class LockClass : uint8_t {
+    GRAPH,     ///< ObserverGraph structure and compact topology.
+    RESOURCE,  ///< Value storage of a node.
+    FUNCTION,  ///< Computation function of a calc node.
+    OBSERVERS, ///< Observer set of a node.
+    OTHER,     ///< Every other lock: feeds, histories, schedulers, transports.
+};
+
+/// @brief Number of lock classes.
+inline constexpr size_t LOCK_CLASS_COUNT = static_cast<size_t>(LockClass::OTHER) + 1;
+
+/// @brief Human-readable name of a lock class.
+constexpr const char *lockClassName(LockClass lockClass) noexcept {
+    switch (lockClass) {
+    case LockClass::GRAPH: return "graph";
+    case LockClass::RESOURCE: return "resource";
+    case LockClass::FUNCTION: return "function";
+    case LockClass::OBSERVERS: return "observers";
+    case LockClass::OTHER: return "other";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Histogram of durations in power-of-two nanosecond buckets.
+ *
+ * Bucket 0 counts durations below 2ns, bucket i durations in [2^i, 2^(i+1)) ns.
+ */
+struct LockHistogram {
+    static constexpr size_t BUCKETS = 40;
+
+    std::array<uint64_t, BUCKETS> buckets{};
+
+    /// @brief Bucket a duration falls into.
+    static constexpr size_t bucketOf(uint64_t nanoseconds) noexcept {
+        size_t bucket = nanoseconds < 2 ? 0 : static_cast<size_t>(std::bit_width(nanoseconds)) - 1;
+        return bucket < BUCKETS ? bucket : BUCKETS - 1;
+    }
+
+    /// @brief Number of recorded durations.
+    [[nodiscard]] uint64_t count() const noexcept {
+        uint64_t total = 0;
+        for (uint64_t n : buckets) total += n;
+        return total;
+    }
+
+    /**
+     * @brief Upper bound of the duration below which a fraction of samples lie.
+     * @param fraction Fraction in [0, 1], e.g. 0.99 for the 99th percentile.
+     * @return uint64_t Exclusive upper bound in nanoseconds, 0 without samples.
+     */
+    [[nodiscard]] uint64_t percentile(double fraction) const noexcept {
+        const uint64_t total = count();
+        if (total == 0) return 0;
+        const auto rank = static_cast<uint64_t>(fraction * static_cast<double>(total - 1));
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            seen += buckets[bucket];
+            if (seen > rank) return uint64_t{2} << bucket;
+        }
+        return uint64_t{2} << (BUCKETS - 1);
+    }
+};
+
+/**
+ * @brief Contention statistics of one lock class.
+ */
+struct LockClassStats {
+    uint64_t acquisitions = 0; ///< Successful exclusive and shared acquisitions.
+    uint64_t contended = 0;    ///< Acquisitions that had to wait for another holder.
+    LockHistogram wait;        ///< Time spent waiting in contended acquisitions.
+    LockHistogram hold;        ///< Time exclusive holders kept the lock.
+};
+
+/**
+ * @brief Process-wide lock contention counters, one set per lock class.
+ *
+ * Counters are only updated when the library is built with
+ * REACTION_LOCK_STATS=1 and thread safety is enabled; single-threaded mode
+ * takes no locks and therefore records nothing. Without the switch the
+ * conditional mutexes compile to the plain wrappers and every snapshot is
+ * zero.
+ *
+ * Shared holders are counted but their hold time is not measured, since a
+ * shared lock has no single owner to attribute it to.
+ */
+class LockStats {
+public:
+    /// @brief Whether instrumentation is compiled in.
+    static constexpr bool ENABLED = REACTION_LOCK_STATS != 0;
+
+    /**
+     * @brief Get the singleton instance.
+     * @return LockStats& Reference to the singleton instance.
+     */
+    static LockStats &getInstance() noexcept {
+        static LockStats instance;
+        return instance;
+    }
+
+    /**
+     * @brief Copy the counters of a lock class.
+     * @param lockClass Class to report.
+     * @return LockClassStats Counters at the time of the call.
+     */
+    [[nodiscard]] LockClassStats snapshot(LockClass lockClass) const noexcept {
+        const Counters &counters = m_counters[static_cast<size_t>(lockClass)];
+        LockClassStats stats;
+        stats.acquisitions = counters.acquisitions.load(std::memory_order_relaxed);
+        stats.contended = counters.contended.load(std::memory_order_relaxed);
+        for (size_t bucket = 0; bucket < LockHistogram::BUCKETS; ++bucket) {
+            stats.wait.buckets[bucket] = counters.wait[bucket].load(std::memory_order_relaxed);
+            stats.hold.buckets[bucket] = counters.hold[bucket].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    /// @brief Zero all counters.
+    void reset() noexcept {
+        for (Counters &counters : m_counters) {
+            counters.acquisitions.store(0, std::memory_order_relaxed);
+            counters.contended.store(0, std::memory_order_relaxed);
+            for (size_t bucket = 0; bucket < LockHistogram::BUCKETS; ++bucket) {
+                counters.wait[bucket].store(0, std::memory_order_relaxed);
+                counters.hold[bucket].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Record an acquisition and, if it was contended, its wait time.
+    void recordAcquire(LockClass lockClass, bool contended, uint64_t waitNs) noexcept {
+        Counters &counters = m_counters[static_cast<size_t>(lockClass)];
+        counters.acquisitions.fetch_add(1, std::memory_order_relaxed);
+        if (contended) {
+            counters.contended.fetch_add(1, std::memory_order_relaxed);
+            counters.wait[LockHistogram::bucketOf(waitNs)].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Record how long an exclusive holder kept a lock.
+    void recordHold(LockClass lockClass, uint64_t holdNs) noexcept {
+        m_counters[static_cast<size_t>(lockClass)].hold[LockHistogram::bucketOf(holdNs)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Current time on the clock used for lock timings, in nanoseconds.
+    static uint64_t now() noexcept {
+        auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    /**
+     * @brief Live counters of one class, on their own cache lines.
+     */
+    struct alignas(64) Counters {
+        std::atomic<uint64_t> acquisitions{0};
+        std::atomic<uint64_t> contended{0};
+        std::array<std::atomic<uint64_t>, LockHistogram::BUCKETS> wait{};
+        std::array<std::atomic<uint64_t>, LockHistogram::BUCKETS> hold{};
+    };
+
+    LockStats() = default;
+    LockStats(const LockStats &) = delete;
+    LockStats &operator=(const LockStats &) = delete;
+
+    std::array<Counters, LOCK_CLASS_COUNT> m_counters; ///< Counters per lock class.
+};
+
+} // namespace reaction
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/concurrency/thread_manager.h"
+#include "reaction/core/exception.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#define REACTION_HAS_CPU_AFFINITY 1
+#include <pthread.h>
+#include <sched.h>
+#else
+#define REACTION_HAS_CPU_AFFINITY 0
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Identifier of a graph partition owned by one NUMA node.
+ */
+using PartitionId = uint32_t;
+
+/**
+ * @brief NUMA nodes of the machine and the CPUs belonging to each.
+ *
+ * The topology is normally read from sysfs, but can be overridden through the
+ * REACTION_NUMA_TOPOLOGY environment variable or built explicitly, which lets
+ * placement be exercised on single-socket machines. The textual form lists
+ * the CPUs of each node in sysfs cpulist syntax, nodes separated by ';':
+ * "0-3,8-11;4-7,12-15" describes two nodes with eight CPUs each.
+ */
+class NumaTopology {
+public:
+    /**
+     * @brief Detect the topology of the running machine.
+     *
+     * REACTION_NUMA_TOPOLOGY takes precedence when set. Without NUMA information
+     * the machine is reported as a single node owning every CPU.
+     * @return NumaTopology The detected topology.
+     * @throws InvalidStateException if REACTION_NUMA_TOPOLOGY is malformed.
+     */
+    [[nodiscard]] static NumaTopology detect() {
+        if (const char *spec = std::getenv("REACTION_NUMA_TOPOLOGY"); spec && *spec) {
+            return parse(spec);
+        }
+        NumaTopology topology;
+#if defined(__linux__)
+        for (uint32_t node = 0;; ++node) {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            std::string cpulist;
+            if (!file || !std::getline(file, cpulist)) break;
+            topology.m_nodes.push_back(parseCpuList(cpulist));
+        }
+#endif
+        if (topology.m_nodes.empty()) {
+            topology.m_nodes.push_back(allCpus());
+        }
+        return topology;
+    }
+
+    /**
+     * @brief Parse a topology description.
+     * @param spec Per-node cpulists separated by ';'.
+     * @return NumaTopology The described topology.
+     * @throws InvalidStateException if the description is malformed.
+     */
+    [[nodiscard]] static NumaTopology parse(const std::string &spec) {
+        NumaTopology topology;
+        size_t begin = 0;
+        while (begin <= spec.size()) {
+            size_t end = spec.find(';', begin);
+            if (end == std::string::npos) end = spec.size();
+            topology.m_nodes.push_back(parseCpuList(spec.substr(begin, end - begin)));
+            begin = end + 1;
+        }
+        return topology;
+    }
+
+    /**
+     * @brief Build an evenly split topology.
+     * @param nodes Number of nodes.
+     * @param cpusPerNode CPUs per node, numbered consecutively.
+     * @return NumaTopology The simulated topology.
+     */
+    [[nodiscard]] static NumaTopology simulated(size_t nodes, size_t cpusPerNode) {
+        NumaTopology topology;
+        for (size_t node = 0; node < nodes; ++node) {
+            std::vector<uint32_t> cpus;
+            for (size_t cpu = 0; cpu < cpusPerNode; ++cpu) {
+                cpus.push_back(static_cast<uint32_t>(node * cpusPerNode + cpu));
+            }
+            topology.m_nodes.push_back(std::move(cpus));
+        }
+        return topology;
+    }
+
+    /// @brief Number of NUMA nodes.
+    [[nodiscard]] size_t size() const noexcept {
+        return m_nodes.size();
+    }
+
+    /// @brief CPUs of a node.
+    [[nodiscard]] const std::vector<uint32_t> &cpus(size_t node) const {
+        return m_nodes.at(node);
+    }
+
+private:
+    static std::vector<uint32_t> parseCpuList(const std::string &list) {
+        std::vector<uint32_t> cpus;
+        size_t pos = 0;
+        auto number = [&]() {
+            size_t digits = 0;
+            uint32_t value = 0;
+            while (pos < list.size() && list[pos] >= '0' && list[pos] <= '9') {
+                value = value * 10 + static_cast<uint32_t>(list[pos++] - '0');
+                ++digits;
+            }
+            if (digits == 0) {
+                REACTION_THROW_INVALID_STATE("malformed cpulist '" + list + "'", "list of CPU ranges such as 0-3,8");
+            }
+            return value;
+        };
+        while (pos < list.size() && list[pos] != '\n') {
+            uint32_t first = number();
+            uint32_t last = first;
+            if (pos < list.size() && list[pos] == '-') {
+                ++pos;
+                last = number();
+            }
+            for (uint32_t cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(cpu);
+            }
+            if (pos < list.size() && list[pos] == ',') ++pos;
+        }
+        if (cpus.empty()) {
+            REACTION_THROW_INVALID_STATE("NUMA node without CPUs", "at least one CPU per node");
+        }
+        return cpus;
+    }
+
+    static std::vector<uint32_t> allCpus() {
+        std::vector<uint32_t> cpus(std::max(1u, std::thread::hardware_concurrency()));
+        for (uint32_t cpu = 0; cpu < cpus.size(); ++cpu) {
+            cpus[cpu] = cpu;
+        }
+        return cpus;
+    }
+
+    std::vector<std::vector<uint32_t>> m_nodes; ///< CPUs of each node.
+};
+
+/**
+ * @brief Worker pool with one group of CPU-pinned workers per NUMA node.
+ *
+ * Graph partitions are owned by NUMA nodes, and all work submitted for a
+ * partition runs on the workers of its owner. Building a partition through
+ * submit() allocates its nodes from those workers, so under the default
+ * first-touch policy the node memory lands on the owning socket; writing
+ * the partition's sources through submit() then keeps propagation of its
+ * cone on the same socket.
+ *
+ * Pinning is best effort: CPUs of a simulated topology that do not exist on
+ * the machine are skipped, and the worker runs unpinned if none remain.
+ * With one worker per node, tasks of a partition run in submission order.
+ */
+class NumaWorkerPool {
+public:
+    /// @brief Returned by currentNode() outside of pool workers.
+    static constexpr size_t NO_NODE = static_cast<size_t>(-1);
+
+    /**
+     * @brief Start the workers.
+     * @param topology Topology to place workers on.
+     * @param workersPerNode Number of workers per node.
+     */
+    explicit NumaWorkerPool(NumaTopology topology = NumaTopology::detect(), size_t workersPerNode = 1)
+        : m_topology(std::move(topology)), m_workersPerNode(workersPerNode), m_queues(m_topology.size()) {
+        // Partitions propagate concurrently from the start
+        ThreadManager::getInstance().enableThreadSafety();
+        for (size_t node = 0; node < m_topology.size(); ++node) {
+            for (size_t i = 0; i < workersPerNode; ++i) {
+                m_workers.emplace_back([this, node]() { run(node); });
+            }
+        }
+    }
+
+    ~NumaWorkerPool() {
+        // Queued work is drained first; a wake-up without a task stops a worker
+        for (auto &queue : m_queues) {
+            queue.pending.release(static_cast<std::ptrdiff_t>(m_workersPerNode));
+        }
+        for (auto &worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    NumaWorkerPool(const NumaWorkerPool &) = delete;
+    NumaWorkerPool &operator=(const NumaWorkerPool &) = delete;
+
+    /**
+     * @brief Assign a partition to a node.
+     *
+     * Unassigned partitions are spread round-robin by id. Reassigning only
+     * affects work submitted afterwards; existing nodes stay where they are.
+     * @param partition Partition to assign.
+     * @param node Owning node.
+     * @throws InvalidStateException if the node does not exist.
+     */
+    void assign(PartitionId partition, size_t node) {
+        if (node >= m_topology.size()) {
+            REACTION_THROW_INVALID_STATE("NUMA node " + std::to_string(node) + " does not exist",
+                "node below " + std::to_string(m_topology.size()));
+        }
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        m_assignment[partition] = node;
+    }
+
+    /// @brief Node owning a partition.
+    [[nodiscard]] size_t nodeOf(PartitionId partition) const {
+        std::lock_guard<std::mutex> lock(m_assignmentMutex);
+        auto it = m_assignment.find(partition);
+        return it != m_assignment.end() ? it->second : partition % m_topology.size();
+    }
+
+    /**
+     * @brief Run work for a partition on its owning node.
+     *
+     * @param partition Partition the work belongs to.
+     * @param fun Work to run, e.g. building nodes or writing sources.
+     * @return std::future of the result; exceptions thrown by fun are rethrown by get().
+     */
+    template <typename F>
+    auto submit(PartitionId partition, F &&fun) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using R = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fun));
+        auto result = task->get_future();
+        Queue &queue = m_queues[nodeOf(partition)];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.emplace_back([task]() { (*task)(); });
+        }
+        queue.pending.release();
+        return result;
+    }
+
+    /// @brief Topology the pool runs on.
+    [[nodiscard]] const NumaTopology &topology() const noexcept {
+        return m_topology;
+    }
+
+    /// @brief Node of the calling pool worker, or NO_NODE.
+    [[nodiscard]] static size_t currentNode() noexcept {
+        return t_currentNode;
+    }
+
+private:
+    /**
+     * @brief Pending work of one node.
+     */
+    struct Queue {
+        std::mutex mutex;
+        std::counting_semaphore<> pending{0};   ///< Queued tasks, plus one wake-up per worker on shutdown.
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void run(size_t node) {
+        t_currentNode = node;
+        pin(m_topology.cpus(node));
+        Queue &queue = m_queues[node];
+        for (;;) {
+            std::function<void()> task;
+            queue.pending.acquire();
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty()) return;
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    static void pin(const std::vector<uint32_t> &cpus) noexcept {
+#if REACTION_HAS_CPU_AFFINITY
+        const unsigned available = std::thread::hardware_concurrency();
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        size_t count = 0;
+        for (uint32_t cpu : cpus) {
+            if (cpu < available && cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &set);
+                ++count;
+            }
+        }
+        if (count > 0) {
+            pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        }
+#else
+        (void)cpus;
+#endif
+    }
+
+    inline static thread_local size_t t_currentNode = NO_NODE;
+
+    NumaTopology m_topology;                                ///< Node layout.
+    size_t m_workersPerNode;                                ///< Workers serving each queue.
+    std::vector<Queue> m_queues;                            ///< One queue per node.
+    std::vector<std::thread> m_workers;                     ///< All workers.
+    mutable std::mutex m_assignmentMutex;                   ///< Protects m_assignment.
+    std::unordered_map<PartitionId, size_t> m_assignment;   ///< Explicit partition owners.
+};
+
+} // namespace reaction
@@ -7,12 +7,15 @@
 
 #pragma once
 
+#include "reaction/concurrency/lock_stats.h"
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 // Compile-time configuration for forcing thread safety
 #ifndef REACTION_FORCE_THREAD_SAFETY
@@ -196,21 +199,47 @@ public:
  * This template automatically adapts between thread-safe and single-threaded modes
  * with compile-time optimization for better performance.
  *
+ * With REACTION_LOCK_STATS=1 every acquisition is reported to LockStats under
+ * the lock class given at construction: a failed try-lock marks it contended
+ * and times the wait, and exclusive holders are timed until unlock. Without
+ * the switch the class tag is discarded and the wrapper is the plain one.
+ *
  * @tparam MutexType The underlying mutex type (std::mutex, std::shared_mutex, etc.)
  */
 template <typename MutexType>
 class ConditionalMutexWrapper {
 public:
+    /**
+     * @brief Create the mutex.
+     * @param lockClass Class the lock's contention is reported under.
+     */
+    explicit ConditionalMutexWrapper([[maybe_unused]] LockClass lockClass = LockClass::OTHER) noexcept {
+        if constexpr (LockStats::ENABLED) {
+            m_stats.lockClass = lockClass;
+        }
+    }
+
+    ConditionalMutexWrapper(const ConditionalMutexWrapper &) = delete;
+    ConditionalMutexWrapper &operator=(const ConditionalMutexWrapper &) = delete;
+
     /// @brief Acquire lock if thread safety is enabled.
     void lock() noexcept(noexcept(std::declval<MutexType>().lock())) {
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) [[likely]] {
-            m_mutex.lock();
+            if constexpr (LockStats::ENABLED) {
+                acquireTimed([this]() { return m_mutex.try_lock(); }, [this]() { m_mutex.lock(); });
+                m_stats.acquiredAt = LockStats::now();
+            } else {
+                m_mutex.lock();
+            }
         }
     }
 
     /// @brief Release lock if thread safety is enabled.
     void unlock() noexcept(noexcept(std::declval<MutexType>().unlock())) {
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) [[likely]] {
+            if constexpr (LockStats::ENABLED) {
+                LockStats::getInstance().recordHold(m_stats.lockClass, LockStats::now() - m_stats.acquiredAt);
+            }
             m_mutex.unlock();
         }
     }
@@ -218,7 +247,14 @@ public:
     /// @brief Try to acquire lock if thread safety is enabled.
     [[nodiscard]] bool try_lock() noexcept(noexcept(std::declval<MutexType>().try_lock())) {
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) [[likely]] {
-            return m_mutex.try_lock();
+            if constexpr (LockStats::ENABLED) {
+                if (!m_mutex.try_lock()) return false;
+                LockStats::getInstance().recordAcquire(m_stats.lockClass, false, 0);
+                m_stats.acquiredAt = LockStats::now();
+                return true;
+            } else {
+                return m_mutex.try_lock();
+            }
         }
         return true; // Always succeed when thread safety is disabled
     }
@@ -228,7 +264,11 @@ public:
     auto lock_shared() noexcept(noexcept(std::declval<T>().lock_shared()))
         -> decltype(std::declval<T>().lock_shared(), void()) {
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) [[likely]] {
-            m_mutex.lock_shared();
+            if constexpr (LockStats::ENABLED) {
+                acquireTimed([this]() { return m_mutex.try_lock_shared(); }, [this]() { m_mutex.lock_shared(); });
+            } else {
+                m_mutex.lock_shared();
+            }
         }
     }
 
@@ -244,13 +284,43 @@ public:
     auto try_lock_shared() noexcept(noexcept(std::declval<T>().try_lock_shared()))
         -> decltype(std::declval<T>().try_lock_shared()) {
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) [[likely]] {
-            return m_mutex.try_lock_shared();
+            if constexpr (LockStats::ENABLED) {
+                if (!m_mutex.try_lock_shared()) return false;
+                LockStats::getInstance().recordAcquire(m_stats.lockClass, false, 0);
+                return true;
+            } else {
+                return m_mutex.try_lock_shared();
+            }
         }
         return true; // Always succeed when thread safety is disabled
     }
 
 private:
+    /**
+     * @brief Per-lock instrumentation state, present only with REACTION_LOCK_STATS.
+     */
+    struct Stats {
+        LockClass lockClass = LockClass::OTHER; ///< Class reported to LockStats.
+        uint64_t acquiredAt = 0;                ///< Acquisition time of the exclusive holder.
+    };
+    struct NoStats {};
+
+    /**
+     * @brief Acquire through a try-lock first, timing the blocking fallback.
+     */
+    template <typename TryLock, typename Lock>
+    void acquireTimed(TryLock tryLock, Lock lock) {
+        if (tryLock()) [[likely]] {
+            LockStats::getInstance().recordAcquire(m_stats.lockClass, false, 0);
+            return;
+        }
+        const uint64_t start = LockStats::now();
+        lock();
+        LockStats::getInstance().recordAcquire(m_stats.lockClass, true, LockStats::now() - start);
+    }
+
     MutexType m_mutex;
+    [[no_unique_address]] std::conditional_t<LockStats::ENABLED, Stats, NoStats> m_stats;
 };
 
 /**
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "reaction/core/expected.h"
+#include "reaction/core/skippable.h"
 #include <concepts>
 #include <memory>
 
@@ -19,6 +21,7 @@ class ObserverNode;
 struct VarExpr;
 struct Void;
 struct ChangeTrig;
+struct AdaptiveTrig;
 
 template <typename Op, typename L, typename R>
 class BinaryOpExpr;
@@ -55,7 +58,13 @@ concept IsVarExpr = std::is_same_v<T, VarExpr>;
  * @brief Determines if the type is a change-trigger marker.
  */
 template <typename T>
-concept IsChangeTrig = std::is_same_v<T, ChangeTrig>;
+concept IsChangeTrig = std::derived_from<T, ChangeTrig>;
+
+/**
+ * @brief Determines if the type is the adaptive eager/lazy trigger.
+ */
+template <typename T>
+concept IsAdaptiveTrig = std::is_same_v<T, AdaptiveTrig>;
 
 /**
  * @brief Checks if the type is const (after removing reference).
@@ -295,6 +304,17 @@ concept IsReact = ReactTraits<std::remove_cvref_t<T>>::value;
 template <typename T>
 concept NonReact = !IsReact<T>;
 
+/**
+ * @brief Checks whether a callable must be lifted over error-valued arguments.
+ *
+ * True when some argument is an Expected node and the callable only accepts
+ * the unwrapped value types.
+ */
+template <typename Fun, typename... Args>
+concept LiftsExpected = (IsExpected<typename ReactTraits<Args>::type> || ...) &&
+                        !std::is_invocable_v<Fun, typename ReactTraits<Args>::type...> &&
+                        std::is_invocable_v<Fun, UnwrapExpected<typename ReactTraits<Args>::type>...>;
+
 /**
  * @brief Extracts the return type from a callable expression using the React argument types.
  */
@@ -304,6 +324,17 @@ struct ExpressionTraits {
     using type = std::conditional_t<VoidType<raw_type>, Void, std::remove_cvref_t<raw_type>>;
 };
 
+/**
+ * @brief Lifted form: the result becomes Expected so input errors can be forwarded.
+ */
+template <typename Fun, typename... Args>
+    requires LiftsExpected<Fun, Args...>
+struct ExpressionTraits<Fun, Args...> {
+    using raw_type = std::remove_cvref_t<std::invoke_result_t<Fun, UnwrapExpected<typename ReactTraits<Args>::type>...>>;
+    using type = std::conditional_t<VoidType<raw_type>, Void,
+        std::conditional_t<IsExpected<raw_type>, raw_type, Expected<raw_type>>>;
+};
+
 /**
  * @brief Alias to get the return type of a callable using React traits.
  */
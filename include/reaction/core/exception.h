@@ -7,10 +7,22 @@
 
 #pragma once
 
+#include <cstdio>
+#include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+
+// Exception support detection; REACTION_EXCEPTIONS=0 selects the exception-free mode
+#ifndef REACTION_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define REACTION_EXCEPTIONS 1
+#else
+#define REACTION_EXCEPTIONS 0
+#endif
+#endif
 
 namespace reaction {
 
@@ -346,11 +358,89 @@ private:
     std::string m_conflictDescription;
 };
 
+/**
+ * @brief Handler invoked for unrecoverable errors in the exception-free mode.
+ */
+using FatalErrorHandler = void (*)(const ReactionException &);
+
+/**
+ * @brief Access the installed fatal error handler.
+ */
+inline FatalErrorHandler &fatalErrorHandler() noexcept {
+    static FatalErrorHandler handler = nullptr;
+    return handler;
+}
+
+/**
+ * @brief Install a handler called before aborting on an unrecoverable error.
+ *
+ * Only used when the library is built without exceptions; recoverable
+ * failures should be modeled as Expected values instead.
+ */
+inline void setFatalErrorHandler(FatalErrorHandler handler) noexcept {
+    fatalErrorHandler() = handler;
+}
+
+/**
+ * @brief Report an unrecoverable error and abort (exception-free mode).
+ */
+[[noreturn]] inline void raiseFatal(const ReactionException &error) noexcept {
+    if (auto handler = fatalErrorHandler()) {
+        handler(error);
+    } else {
+        std::fputs(error.what(), stderr);
+        std::fputc('\n', stderr);
+    }
+    std::abort();
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define REACTION_COLD __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define REACTION_COLD __declspec(noinline)
+#else
+#define REACTION_COLD
+#endif
+
+namespace detail {
+
+/**
+ * @brief Construct and raise an exception out of line.
+ *
+ * Building the message strings and the exception object takes far more code
+ * than the check guarding it. Keeping that code in one cold function per
+ * exception and argument type means the typed node templates only carry a
+ * call, instead of a copy of it in every instantiation.
+ */
+template <typename ExceptionType, typename... Args>
+[[noreturn]] REACTION_COLD void raise(const char *file, int line, const char *function, Args... args) {
+#if REACTION_EXCEPTIONS
+    throw ExceptionType(std::move(args)..., file, line, function);
+#else
+    raiseFatal(ExceptionType(std::move(args)..., file, line, function));
+#endif
+}
+
+} // namespace detail
+
 /**
  * @brief Convenience macros for throwing exceptions with file/line information.
+ *
+ * Without exception support the exception is reported through the fatal
+ * error handler instead. REACTION_TRY / REACTION_CATCH / REACTION_RETHROW
+ * compile to plain blocks in that mode, since nothing can be thrown.
  */
 #define REACTION_THROW(ExceptionType, ...) \
-    throw ExceptionType(__VA_ARGS__, __FILE__, __LINE__, __FUNCTION__)
+    ::reaction::detail::raise<ExceptionType>(__FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+#if REACTION_EXCEPTIONS
+#define REACTION_TRY try
+#define REACTION_CATCH(...) catch (__VA_ARGS__)
+#define REACTION_RETHROW throw
+#else
+#define REACTION_TRY if (true)
+#define REACTION_CATCH(...) else if (false)
+#define REACTION_RETHROW std::abort()
+#endif
 
 #define REACTION_THROW_DEPENDENCY_CYCLE(sourceName, targetName) \
     REACTION_THROW(DependencyCycleException, sourceName, targetName)
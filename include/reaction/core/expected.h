@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/exception.h"
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace reaction {
+
+/**
+ * @brief Lightweight error value carried by error-valued nodes.
+ *
+ * Trivially copyable so that propagating an error downstream costs no more
+ * than propagating a value; the message must have static storage duration.
+ */
+struct Error {
+    ReactionException::ErrorCode code = ReactionException::ErrorCode::UNKNOWN; ///< Category of the error.
+    const char *message = "";                                                ///< Static description.
+
+    bool operator==(const Error &other) const noexcept {
+        return code == other.code && message == other.message;
+    }
+};
+
+/**
+ * @brief Holds either a value of type T or an Error.
+ *
+ * A node whose type is Expected<T> carries failures as ordinary values: a
+ * calc reading it with a function that takes a plain T is skipped while the
+ * input holds an error, and the error is forwarded to its own value instead.
+ * Errors therefore travel through the graph by normal propagation, without
+ * unwinding the stack.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class Expected {
+    static_assert(!std::is_same_v<T, Error>, "Expected<Error> is ambiguous");
+
+public:
+    using value_type = T;
+
+    /// @brief Default constructs a value.
+    Expected() = default;
+
+    /// @brief Construct holding a value.
+    template <typename U = T>
+        requires(std::is_constructible_v<T, U &&> && !std::is_same_v<std::remove_cvref_t<U>, Expected> && !std::is_same_v<std::remove_cvref_t<U>, Error>)
+    Expected(U &&value) : m_state(std::in_place_index<0>, std::forward<U>(value)) {}
+
+    /// @brief Construct holding an error.
+    Expected(Error error) noexcept : m_state(std::in_place_index<1>, error) {}
+
+    /// @brief Whether a value is held.
+    [[nodiscard]] bool hasValue() const noexcept {
+        return m_state.index() == 0;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return hasValue();
+    }
+
+    /**
+     * @brief Access the held value.
+     * @throws InvalidStateException if an error is held.
+     */
+    [[nodiscard]] const T &value() const & {
+        if (!hasValue()) [[unlikely]] {
+            REACTION_THROW_INVALID_STATE(std::get<1>(m_state).message, "value");
+        }
+        return *std::get_if<0>(&m_state);
+    }
+
+    [[nodiscard]] T &value() & {
+        return const_cast<T &>(std::as_const(*this).value());
+    }
+
+    [[nodiscard]] const T &operator*() const noexcept {
+        return *std::get_if<0>(&m_state);
+    }
+
+    [[nodiscard]] const T *operator->() const noexcept {
+        return std::get_if<0>(&m_state);
+    }
+
+    /// @brief The held value, or the fallback if an error is held.
+    template <typename U>
+    [[nodiscard]] T valueOr(U &&fallback) const {
+        return hasValue() ? **this : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /// @brief The held error; a default Error if a value is held.
+    [[nodiscard]] Error error() const noexcept {
+        const Error *error = std::get_if<1>(&m_state);
+        return error ? *error : Error{};
+    }
+
+    bool operator==(const Expected &other) const {
+        return m_state == other.m_state;
+    }
+
+private:
+    std::variant<T, Error> m_state; ///< The value or the error.
+};
+
+/**
+ * @brief Trait recognizing Expected types.
+ */
+template <typename T>
+struct ExpectedTraits : std::false_type {
+    using value_type = T;
+};
+
+template <typename T>
+struct ExpectedTraits<Expected<T>> : std::true_type {
+    using value_type = T;
+};
+
+/**
+ * @brief Checks whether T is an Expected.
+ */
+template <typename T>
+concept IsExpected = ExpectedTraits<std::remove_cvref_t<T>>::value;
+
+/**
+ * @brief Strip one Expected layer from a type.
+ */
+template <typename T>
+using UnwrapExpected = typename ExpectedTraits<std::remove_cvref_t<T>>::value_type;
+
+/**
+ * @brief Extract the error held by an argument, if any.
+ *
+ * @param arg Argument value, Expected or plain.
+ * @param error Receives the first error found.
+ * @return true if an error was found.
+ */
+template <typename T>
+bool collectError(const T &arg, Error &error) noexcept {
+    if constexpr (IsExpected<T>) {
+        if (!arg.hasValue()) {
+            error = arg.error();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Unwrap an argument known to hold a value.
+ */
+template <typename T>
+decltype(auto) unwrapExpected(const T &arg) noexcept {
+    if constexpr (IsExpected<T>) {
+        return *arg;
+    } else {
+        return (arg);
+    }
+}
+
+} // namespace reaction
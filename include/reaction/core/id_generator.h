@@ -78,8 +78,8 @@ private:
      * @return A unique 64-bit unsigned integer.
      */
     static uint64_t generate() noexcept {
-        static uint64_t counter{0};
-        return counter++;
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed);
     }
 
     // Grant std::hash access to private members.
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/concurrency/thread_manager.h"
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Node names are a debugging aid; define as 0 to compile them out entirely
+#ifndef REACTION_ENABLE_NAMES
+#define REACTION_ENABLE_NAMES 1
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Integer handle of an interned node name.
+ */
+using NameHandle = uint32_t;
+
+/**
+ * @brief Handle of the empty name, carried by unnamed nodes.
+ */
+inline constexpr NameHandle NO_NAME = 0;
+
+/**
+ * @brief Process-wide string table for node names.
+ *
+ * Each distinct name is stored once and identified by a small integer
+ * handle, so nodes only carry the handle and naming never touches the graph
+ * lock. Interned strings live for the rest of the process, which keeps the
+ * returned views valid.
+ */
+class NameTable {
+public:
+    /**
+     * @brief Get the singleton instance of the name table.
+     * @return NameTable& singleton reference.
+     */
+    [[nodiscard]] static NameTable &getInstance() noexcept {
+        static NameTable instance;
+        return instance;
+    }
+
+    /**
+     * @brief Intern a name.
+     * @param name Name to intern.
+     * @return NameHandle Handle of the name, NO_NAME for the empty string.
+     */
+    NameHandle intern(std::string_view name) {
+        if (name.empty()) return NO_NAME;
+        {
+            ConditionalSharedLock<ConditionalSharedMutex> lock(m_mutex);
+            if (auto it = m_index.find(name); it != m_index.end()) {
+                return it->second;
+            }
+        }
+
+        ConditionalUniqueLock<ConditionalSharedMutex> lock(m_mutex);
+        if (auto it = m_index.find(name); it != m_index.end()) {
+            return it->second;
+        }
+        const std::string &stored = m_names.emplace_back(name);
+        const auto handle = static_cast<NameHandle>(m_names.size());
+        m_index.emplace(stored, handle);
+        return handle;
+    }
+
+    /**
+     * @brief Look up an interned name.
+     * @param handle Handle returned by intern().
+     * @return std::string_view The name, empty for NO_NAME or unknown handles.
+     */
+    [[nodiscard]] std::string_view view(NameHandle handle) const noexcept {
+        if (handle == NO_NAME) return {};
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_mutex);
+        return handle <= m_names.size() ? std::string_view(m_names[handle - 1]) : std::string_view{};
+    }
+
+    /// @brief Number of distinct names interned so far.
+    [[nodiscard]] size_t size() const noexcept {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_mutex);
+        return m_names.size();
+    }
+
+private:
+    NameTable() = default;
+
+    mutable ConditionalSharedMutex m_mutex;                    ///< Protects the table.
+    std::deque<std::string> m_names;                           ///< Interned strings; handle h is at h - 1.
+    std::unordered_map<std::string_view, NameHandle> m_index;  ///< Name to handle lookup.
+};
+
+} // namespace reaction
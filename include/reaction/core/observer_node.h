@@ -7,8 +7,14 @@
 
 #pragma once
 
+#include "reaction/concurrency/global_state.h"
 #include "reaction/concurrency/thread_manager.h"
+#include "reaction/core/id_generator.h"
+#include "reaction/core/name_table.h"
 #include "reaction/core/types.h"
+#include "reaction/graph/compact_topology.h"
+#include "reaction/memory/alloc_tracking.h"
+#include "reaction/memory/graph_memory.h"
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -19,6 +25,7 @@ namespace reaction {
 
 // Forward declarations
 class ObserverGraph;
+class HistoryBase;
 
 /**
  * @brief Reactive graph node base class.
@@ -28,7 +35,7 @@ class ObserverGraph;
  */
 class ObserverNode : public std::enable_shared_from_this<ObserverNode> {
 public:
-    virtual ~ObserverNode() = default;
+    virtual ~ObserverNode();
 
     /**
      * @brief Trigger downstream notifications.
@@ -76,31 +83,23 @@ public:
         }
     }
 
-    /**
-     * @brief Update all observer dependencies at once.
-     *
-     * Resets current observers, then adds given nodes as new observers.
-     * @tparam Args Parameter pack for node pointers.
-     * @param args Nodes to observe.
-     */
-    template <typename... Args>
-    void updateObservers(Args &&...args);
-
-    /**
-     * @brief Add a single observer node.
-     * @param node Observer node to add.
-     */
-    void addOneObserver(const NodePtr &node);
-
     /**
      * @brief Notify observers and delayed repeat nodes.
      * @param changed Whether the node's value has changed.
      */
     void notify(bool changed = true) {
+        if (changed && g_sliced_propagation.load(std::memory_order_relaxed)) [[unlikely]] {
+            parkObservers();
+            return;
+        }
+        if (notifyCompact(changed)) {
+            return;
+        }
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) {
             // Copy observers under lock to avoid holding lock during callbacks
             std::vector<std::shared_ptr<ObserverNode>> observersCopy;
             {
+                AllocScope scope(AllocSubsystem::NOTIFY);
                 ConditionalSharedLock<ConditionalSharedMutex> lock(m_observersMutex);
                 observersCopy.reserve(m_observers.size());
                 for (auto &observer : m_observers) {
@@ -123,29 +122,129 @@ public:
         }
     }
 
+    /**
+     * @brief Check whether this node has parked work from a sliced propagation.
+     * @return true if the node's value may lag behind its inputs.
+     */
+    [[nodiscard]] bool isStale() const noexcept {
+        return m_stale.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the unique identifier of this node.
+     * @return uint64_t Process-wide unique node id.
+     */
+    [[nodiscard]] uint64_t getId() const noexcept {
+        return m_id;
+    }
+
+    /**
+     * @brief Get the interned name of this node.
+     * @return NameHandle Handle into the NameTable, NO_NAME if unnamed or names are compiled out.
+     */
+    [[nodiscard]] NameHandle getNameHandle() const noexcept {
+#if REACTION_ENABLE_NAMES
+        return m_name.load(std::memory_order_acquire);
+#else
+        return NO_NAME;
+#endif
+    }
+
+    /**
+     * @brief Get the epoch of this node's last value change.
+     * @return uint64_t Change-feed epoch, 0 if the value never changed.
+     */
+    [[nodiscard]] uint64_t getChangeEpoch() const noexcept {
+        return m_changeEpoch.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the value history of this node.
+     * @return HistoryBase* The history, or nullptr if none is kept.
+     */
+    [[nodiscard]] HistoryBase *getHistory() const noexcept {
+        return m_history.load(std::memory_order_acquire);
+    }
+
+protected:
+    /**
+     * @brief Bring this node up to date if a sliced propagation parked it.
+     */
+    void pullIfStale() const;
+
+    /**
+     * @brief Attach a value history to this node.
+     *
+     * Only the first history is kept; later calls leave it in place.
+     * @param history History to take ownership of.
+     * @return HistoryBase* The history now attached to this node.
+     */
+    HistoryBase *installHistory(std::unique_ptr<HistoryBase> history) noexcept {
+        HistoryBase *expected = nullptr;
+        if (m_history.compare_exchange_strong(expected, history.get(), std::memory_order_acq_rel)) {
+            return history.release();
+        }
+        return expected;
+    }
+
+    /**
+     * @brief Stamp a direct write to this node in the change feed.
+     */
+    void recordSourceChange();
+
+    /**
+     * @brief Reject a source reset while this node takes part in a batch.
+     * @throws BatchConflictException if the node is in an active batch.
+     */
+    void ensureOutsideBatch();
+
+    /**
+     * @brief Replace the nodes this node observes.
+     * @param dependencies New dependencies of this node.
+     * @throws SelfObservationException or DependencyCycleException, leaving the graph unchanged.
+     */
+    void rebindSources(const std::vector<NodePtr> &dependencies);
+
+    /**
+     * @brief Stamp a propagated change of this node in the change feed.
+     */
+    void recordDerivedChange();
+
 private:
+    /**
+     * @brief Hand the downstream cone to the propagation scheduler.
+     */
+    void parkObservers();
+
+    /**
+     * @brief Notify observers through the graph's compact topology, if one is current.
+     * @return true if the snapshot was used, false to fall back to the observer set.
+     */
+    bool notifyCompact(bool changed);
+
+    UniqueID m_id;                                   ///< Unique identifier of this node.
     std::atomic<uint16_t> m_depth{0};               ///< Depth of the node in reactive chain.
-    mutable ConditionalSharedMutex m_observersMutex; ///< Conditional mutex for thread-safe observers access.
-    NodeSet m_observers;                             ///< Direct observers of this node.
+    std::atomic<bool> m_stale{false};               ///< Whether parked propagation work is pending.
+    std::atomic<uint32_t> m_activeBatches{0};       ///< Number of live batches that include this node.
+    std::atomic<uint64_t> m_changeEpoch{0};         ///< Change-feed epoch of the last value change.
+    std::atomic<uint32_t> m_denseIndex{CompactTopology::NO_INDEX}; ///< Index in the last compact topology.
+    std::atomic<HistoryBase *> m_history{nullptr};  ///< Optional value history, owned by this node.
+#if REACTION_ENABLE_NAMES
+    std::atomic<NameHandle> m_name{NO_NAME};        ///< Interned name of this node.
+#endif
+    mutable ConditionalSharedMutex m_observersMutex{LockClass::OBSERVERS}; ///< Conditional mutex for thread-safe observers access.
+    NodeSet m_observers{GraphMemory::getInstance().resource()}; ///< Direct observers of this node.
     friend class ObserverGraph;
+    friend class PropagationScheduler;
+    friend class ChangeFeed;
     friend struct BatchCompare;
+    friend struct CompactPropagation;
 };
 
 } // namespace reaction
 
 // Implementation of methods that require ObserverGraph
 #include "reaction/graph/observer_graph.h"
-
-namespace reaction {
-
-template <typename... Args>
-inline void ObserverNode::updateObservers(Args &&...args) {
-    auto shared_this = shared_from_this();
-    ObserverGraph::getInstance().updateObserversTransactional(shared_this, args...);
-}
-
-inline void ObserverNode::addOneObserver(const NodePtr &node) {
-    ObserverGraph::getInstance().addObserver(shared_from_this(), node);
-}
-
-} // namespace reaction
+#include "reaction/graph/propagation_scheduler.h"
+#include "reaction/graph/change_feed.h"
+#include "reaction/core/value_history.h"
@@ -11,10 +11,13 @@
 #include "reaction/concurrency/global_state.h"
 #include "reaction/concurrency/thread_manager.h"
 #include "reaction/core/exception.h"
+#include "reaction/core/value_history.h"
 #include "reaction/expression/atomic_operations.h"
 #include "reaction/expression/expression.h"
 #include "reaction/graph/batch.h"
 #include "reaction/policy/invalidation.h"
+#include <tuple>
+#include <vector>
 
 namespace reaction {
 
@@ -44,11 +47,19 @@ public:
 
     /// @brief Returns the current evaluated value.
     [[nodiscard]] decltype(auto) get() const {
+        this->pullIfStale();
+        if constexpr (IsAdaptiveTrig<TR> && !IsVarExpr<Expr>) {
+            this->refreshIfDirty();
+        }
         return this->getValue();
     }
 
     /// @brief Returns raw pointer to the stored object (for pointer-based types).
     [[nodiscard]] auto getRaw() const {
+        this->pullIfStale();
+        if constexpr (IsAdaptiveTrig<TR> && !IsVarExpr<Expr>) {
+            this->refreshIfDirty();
+        }
         return this->getRawPtr();
     }
 
@@ -61,7 +72,7 @@ public:
     template <typename F, HasArguments... A>
     void set(F &&f, A &&...args) {
         this->setSource(std::forward<F>(f), std::forward<A>(args)...);
-        this->notify();
+        notifyOrDefer();
     }
 
     /**
@@ -69,20 +80,12 @@ public:
      */
     template <typename F>
     void set(F &&f) {
-        {
-            RegFunGuard g([this](const NodePtr &node) {
-                this->addObCb(node);
-            });
-            this->setSource(std::forward<F>(f));
-        }
-        this->notify();
+        this->setSource(std::forward<F>(f));
+        notifyOrDefer();
     }
 
     /// @brief Set a no-argument expression and auto-track dependencies.
     void set() {
-        RegFunGuard g([this](const NodePtr &node) {
-            this->addObCb(node);
-        });
         this->setOpExpr();
     }
 
@@ -92,6 +95,7 @@ public:
     template <typename T>
         requires(Convertable<T, Type> && IsVarExpr<Expr> && !ConstType<Type>)
     void value(T &&t) {
+        AllocScope scope(AllocSubsystem::WRITE);
         this->setValue(std::forward<T>(t));
     }
 
@@ -100,11 +104,57 @@ public:
      */
     void close() {
         ObserverGraph::getInstance().closeNode(this->shared_from_this());
+        releaseFields();
+    }
+
+    /// @brief Drops the field bindings of a closed node's value, if it has any.
+    void releaseFields() {
         if constexpr (HasField<Type>) {
             FieldGraph::getInstance().deleteObj(this->getValue().getId());
         }
     }
 
+    /**
+     * @brief Keep the last values of this node in a fixed-size history.
+     *
+     * The current value is recorded immediately. The depth is fixed by the first call.
+     * @param depth Number of values retained.
+     */
+    void keepHistory(size_t depth)
+        requires(!VoidType<Type>)
+    {
+        auto history = std::make_unique<ValueHistory<std::remove_cvref_t<Type>>>(depth);
+        history->record(this->getChangeEpoch(), this->getValue());
+        this->installHistory(std::move(history));
+    }
+
+    /**
+     * @brief Read the value this node held at the end of a change-feed epoch.
+     * @param epoch Epoch to look up.
+     * @return The value, or nullopt if no history is kept or it does not reach back that far.
+     */
+    [[nodiscard]] std::optional<std::remove_cvref_t<Type>> getAt(uint64_t epoch) const
+        requires(!VoidType<Type>)
+    {
+        if (auto *history = this->getHistory()) {
+            return static_cast<const ValueHistory<std::remove_cvref_t<Type>> *>(history)->valueAt(epoch);
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Copy out the retained history, oldest first.
+     * @return Retained entries, empty if no history is kept.
+     */
+    [[nodiscard]] std::vector<HistoryEntry<std::remove_cvref_t<Type>>> getHistoryEntries() const
+        requires(!VoidType<Type>)
+    {
+        if (auto *history = this->getHistory()) {
+            return static_cast<const ValueHistory<std::remove_cvref_t<Type>> *>(history)->entries();
+        }
+        return {};
+    }
+
     /// @brief Increases internal weak reference count.
     void addWeakRef() noexcept {
         m_weakRefCount++;
@@ -126,6 +176,15 @@ public:
      */
 
 private:
+    /// @brief Propagate a reset now, or leave it to the enclosing GraphTransaction.
+    void notifyOrDefer() {
+        if (g_graph_transaction) {
+            g_graph_transaction->defer(this->shared_from_this());
+        } else {
+            this->notify();
+        }
+    }
+
     std::atomic<int> m_weakRefCount{0}; ///< Reference counter for weak lifetime tracking.
 };
 
@@ -185,9 +244,9 @@ public:
         return *this;
     }
 
-    /// @brief Compare by internal pointer name (used in containers).
+    /// @brief Order by node id (used in ordered containers); never touches the graph lock.
     bool operator<(const React &other) const {
-        return getName() < other.getName();
+        return getId() < other.getId();
     }
 
     /// @brief Check equality by underlying object pointer.
@@ -223,6 +282,80 @@ public:
         return getPtr()->get();
     }
 
+    /// @brief Check whether a sliced propagation left this node behind its inputs.
+    [[nodiscard]] bool isStale() const {
+        return getPtr()->isStale();
+    }
+
+    /// @brief Check whether an AdaptiveTrig node currently defers recomputation to reads.
+    [[nodiscard]] bool isLazy() const
+        requires IsAdaptiveTrig<TR>
+    {
+        return getPtr()->isLazy();
+    }
+
+    /// @brief Get the unique identifier of the underlying node.
+    [[nodiscard]] uint64_t getId() const {
+        return getPtr()->getId();
+    }
+
+    /// @brief Get the change-feed epoch of this node's last value change.
+    [[nodiscard]] uint64_t getChangeEpoch() const {
+        return getPtr()->getChangeEpoch();
+    }
+
+    /// @brief Check whether this node changed after the given change-feed epoch.
+    [[nodiscard]] bool changedSince(uint64_t epoch) const {
+        return getChangeEpoch() > epoch;
+    }
+
+    /// @brief Keep the last depth values of this node for time-travel reads.
+    React &keepHistory(size_t depth)
+        requires(!VoidType<Type>)
+    {
+        getPtr()->keepHistory(depth);
+        return *this;
+    }
+
+    /// @brief Read the value this node held at the end of the given change-feed epoch.
+    [[nodiscard]] auto getAt(uint64_t epoch) const
+        requires(!VoidType<Type>)
+    {
+        return getPtr()->getAt(epoch);
+    }
+
+    /// @brief Copy out the retained value history, oldest first.
+    [[nodiscard]] auto getHistory() const
+        requires(!VoidType<Type>)
+    {
+        return getPtr()->getHistoryEntries();
+    }
+
+    /**
+     * @brief Report evaluations of this calc that take longer than budget to the Watchdog.
+     * @param budget Time budget per evaluation, zero to switch the check off.
+     */
+    React &timeBudget(std::chrono::nanoseconds budget)
+        requires HasTimeBudget<react_type>
+    {
+        getPtr()->setTimeBudget(budget);
+        return *this;
+    }
+
+    /// @brief Number of evaluations of this calc that exceeded its time budget.
+    [[nodiscard]] uint32_t budgetOverruns() const
+        requires HasTimeBudget<react_type>
+    {
+        return getPtr()->budgetOverruns();
+    }
+
+    /// @brief Check whether the Watchdog marked this calc as a chronic offender.
+    [[nodiscard]] bool isChronicallySlow() const
+        requires HasTimeBudget<react_type>
+    {
+        return getPtr()->isChronicallySlow();
+    }
+
     /// @brief Reset the expression with new source and dependencies.
     template <typename F, typename... A>
     React &reset(F &&f, A &&...args) {
@@ -273,7 +406,7 @@ public:
     }
 
     /// @brief Assign a human-readable name for debugging/tracing.
-    React &setName(const std::string &name) {
+    React &setName(std::string_view name) {
         ObserverGraph::getInstance().setName(getPtr(), name);
         return *this;
     }
@@ -430,13 +563,40 @@ private:
     std::weak_ptr<react_type> m_weakPtr; ///< Weak reference to the implementation node.
     mutable ConditionalMutex m_resetMutex; ///< Mutex for thread-safe reset operations.
 
-    template <typename T, IsTrigger M>
+    template <typename T, IsTrigger M, typename R>
     friend class CalcExprBase;
 
+    template <IsReact... Rs>
+    friend void closeMany(const Rs &...handles);
+
     friend struct FilterTrig;
     friend struct std::hash<React<Expr, Type, IV, TR>>;
 };
 
+/**
+ * @brief Closes several reactive nodes and their dependents in one graph operation.
+ *
+ * Equivalent to calling close() on each handle, but the graph lock is taken
+ * once and shared downstream nodes are visited once. Handles that are
+ * already closed are skipped.
+ *
+ * @param handles Nodes to close.
+ */
+template <IsReact... Rs>
+void closeMany(const Rs &...handles) {
+    REACTION_REGISTER_THREAD();
+    auto impls = std::make_tuple(handles.m_weakPtr.lock()...);
+    std::vector<NodePtr> nodes;
+    nodes.reserve(sizeof...(Rs));
+    std::apply([&nodes](const auto &...ptrs) {
+        (nodes.push_back(ptrs), ...);
+    }, impls);
+    ObserverGraph::getInstance().closeMany(nodes);
+    std::apply([](const auto &...ptrs) {
+        ((ptrs ? ptrs->releaseFields() : void()), ...);
+    }, impls);
+}
+
 } // namespace reaction
 
 /// @brief Hash support for React to allow use in unordered containers.
@@ -10,9 +10,12 @@
 #include "reaction/concurrency/thread_manager.h"
 #include "reaction/core/exception.h"
 #include "reaction/core/observer_node.h"
+#include "reaction/core/value_history.h"
 #include "reaction/memory/sbo_resource.h"
+#include <functional>
 #include <mutex>
 #include <shared_mutex>
+#include <utility>
 
 namespace reaction {
 
@@ -102,6 +105,27 @@ public:
         return *m_ptr;
     }
 
+    /**
+     * @brief Read part of the managed value without copying all of it.
+     *
+     * @param reader Called with a const reference to the value under the read lock.
+     * @return Whatever reader returns.
+     */
+    template <typename F>
+    decltype(auto) readValue(F &&reader) const {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_resourceMutex);
+        if (!m_ptr) {
+            REACTION_THROW_RESOURCE_NOT_INITIALIZED("Resource");
+        }
+        return std::invoke(std::forward<F>(reader), std::as_const(*m_ptr));
+    }
+
+    /// @brief Whether the resource holds a value; getValue() throws otherwise.
+    [[nodiscard]] bool hasValue() const noexcept {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_resourceMutex);
+        return m_ptr != nullptr;
+    }
+
     /**
      * @brief Update the managed resource with a new value.
      *
@@ -162,23 +186,17 @@ public:
         bool changed = false;
         {
             ConditionalUniqueLock<ConditionalSharedMutex> lock(m_resourceMutex);
-            try {
-                // Direct access to avoid lock recursion
-                if (!m_ptr) {
-                    REACTION_THROW_RESOURCE_NOT_INITIALIZED("ResourceImpl");
-                }
-
-                changed = operation(*m_ptr);
-
-                if (alwaysChanged) {
-                    changed = true;
-                }
-            } catch (const std::runtime_error&) {
-                // Resource not initialized, treat as no change
-                changed = false;
+            // Direct access to avoid lock recursion; an uninitialized resource is left unchanged
+            if (m_ptr) {
+                changed = operation(*m_ptr) || alwaysChanged;
             }
         } // Lock is automatically released here
 
+        if (changed) {
+            this->recordSourceChange();
+            publishChange(*this);
+        }
+
         // Trigger notifications like ReactImpl does
         if (!g_batch_execute && changed) {
             this->notify(true);
@@ -193,7 +211,7 @@ public:
     }
 
 protected:
-    mutable ConditionalSharedMutex m_resourceMutex; ///< Conditional mutex for thread-safe resource access.
+    mutable ConditionalSharedMutex m_resourceMutex{LockClass::RESOURCE}; ///< Conditional mutex for thread-safe resource access.
     std::unique_ptr<Type> m_ptr;                    ///< Unique pointer managing the resource
 };
 
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace reaction {
+
+/**
+ * @brief Tag type of the skip result; see Skippable.
+ */
+struct SkipT {
+    explicit constexpr SkipT() = default;
+};
+
+/// @brief Returned by a calc to keep its previous value and stop propagation.
+inline constexpr SkipT skip{};
+
+/**
+ * @brief Result of a calc that may decline to produce a new value.
+ *
+ * A calc whose function returns Skippable<T> is a node of type T. When an
+ * evaluation returns reaction::skip the node keeps its previous value and
+ * notifies nobody, so the cone below it is not recomputed. A calc that skips
+ * its very first evaluation holds no value until it produces one.
+ *
+ * @tparam T Value type.
+ */
+template <typename T>
+class Skippable {
+    static_assert(!std::is_reference_v<T> && !std::is_void_v<T>, "Skippable needs an object type");
+
+public:
+    using value_type = T;
+
+    /// @brief Construct a skip.
+    constexpr Skippable(SkipT) noexcept {}
+
+    /// @brief Construct holding a value.
+    template <typename U = T>
+        requires(std::is_constructible_v<T, U &&> && !std::is_same_v<std::remove_cvref_t<U>, Skippable> && !std::is_same_v<std::remove_cvref_t<U>, SkipT>)
+    constexpr Skippable(U &&value) : m_value(std::in_place, std::forward<U>(value)) {}
+
+    /// @brief Whether a value is held.
+    [[nodiscard]] constexpr bool hasValue() const noexcept {
+        return m_value.has_value();
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept {
+        return hasValue();
+    }
+
+    /// @brief The held value; must not be called on a skip.
+    [[nodiscard]] constexpr T &&operator*() && noexcept {
+        return *std::move(m_value);
+    }
+
+    [[nodiscard]] constexpr const T &operator*() const & noexcept {
+        return *m_value;
+    }
+
+private:
+    std::optional<T> m_value; ///< The value, empty for a skip.
+};
+
+/**
+ * @brief Trait recognizing Skippable types.
+ */
+template <typename T>
+struct SkippableTraits : std::false_type {
+    using value_type = T;
+};
+
+template <typename T>
+struct SkippableTraits<Skippable<T>> : std::true_type {
+    using value_type = T;
+};
+
+/**
+ * @brief Checks whether T is a Skippable.
+ */
+template <typename T>
+concept IsSkippable = SkippableTraits<std::remove_cvref_t<T>>::value;
+
+/**
+ * @brief Strip one Skippable layer from a type.
+ */
+template <typename T>
+using UnwrapSkippable = typename SkippableTraits<std::remove_cvref_t<T>>::value_type;
+
+} // namespace reaction
@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <unordered_set>
 
 namespace reaction {
@@ -46,14 +47,10 @@ namespace std {
  */
 struct WeakPtrHash {
     [[nodiscard]] size_t operator()(const reaction::NodeWeak &wp) const noexcept {
-        try {
-            if (auto ptr = wp.lock()) {
-                return std::hash<reaction::ObserverNode *>()(ptr.get());
-            }
-            return 0;
-        } catch (...) {
-            return 0; // Safe exception handling
+        if (auto ptr = wp.lock()) {
+            return std::hash<reaction::ObserverNode *>()(ptr.get());
         }
+        return 0;
     }
 };
 
@@ -65,11 +62,7 @@ struct WeakPtrHash {
  */
 struct WeakPtrEqual {
     [[nodiscard]] bool operator()(const reaction::NodeWeak &a, const reaction::NodeWeak &b) const noexcept {
-        try {
-            return a.lock() == b.lock();
-        } catch (...) {
-            return false; // Safe exception handling
-        }
+        return a.lock() == b.lock();
     }
 };
 
@@ -84,8 +77,10 @@ namespace reaction {
  *
  * Uses custom hash and equality functions for weak_ptr support.
  * Commonly used for storing collections of reactive node references.
+ * Allocator-aware, so long-lived sets can draw from the graph's memory
+ * resource (see GraphMemory); temporaries use the default resource.
  */
-using NodeSet = std::unordered_set<NodeWeak, std::WeakPtrHash, std::WeakPtrEqual>;
+using NodeSet = std::pmr::unordered_set<NodeWeak, std::WeakPtrHash, std::WeakPtrEqual>;
 
 /**
  * @brief Reference wrapper type for NodeSet.
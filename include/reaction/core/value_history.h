@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/concurrency/change_event_ring.h"
+#include "reaction/concurrency/thread_manager.h"
+#include "reaction/core/observer_node.h"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief One retained value of a node together with when it was produced.
+ *
+ * @tparam Type Value type of the node.
+ */
+template <typename Type>
+struct HistoryEntry {
+    uint64_t epoch;                              ///< Change-feed epoch of the value.
+    std::chrono::system_clock::time_point time;  ///< Wall-clock time the value was recorded.
+    Type value;                                  ///< The value itself.
+};
+
+/**
+ * @brief Type-erased base of per-node value histories, owned by ObserverNode.
+ */
+class HistoryBase {
+public:
+    virtual ~HistoryBase() = default;
+};
+
+/**
+ * @brief Fixed-size ring of the last K values of a node.
+ *
+ * All slots are allocated when the history is enabled; recording a change
+ * reuses the oldest slot. Several changes within the same epoch collapse into
+ * one entry holding the last value of that epoch.
+ *
+ * @tparam Type Value type of the node.
+ */
+template <typename Type>
+class ValueHistory final : public HistoryBase {
+public:
+    /**
+     * @brief Create a history retaining the given number of values.
+     * @param depth Number of values kept (at least one).
+     */
+    explicit ValueHistory(size_t depth) : m_slots(depth == 0 ? 1 : depth) {}
+
+    /**
+     * @brief Record a value produced at the given epoch.
+     * @param epoch Change-feed epoch of the value.
+     * @param value New value of the node.
+     */
+    void record(uint64_t epoch, const Type &value) {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        auto now = std::chrono::system_clock::now();
+        if (m_size > 0) {
+            auto &last = m_slots[(m_head + m_slots.size() - 1) % m_slots.size()];
+            if (last->epoch == epoch) {
+                last->time = now;
+                last->value = value;
+                return;
+            }
+        }
+        m_slots[m_head].emplace(HistoryEntry<Type>{epoch, now, value});
+        m_head = (m_head + 1) % m_slots.size();
+        if (m_size < m_slots.size()) ++m_size;
+    }
+
+    /**
+     * @brief Get the value the node held at the end of the given epoch.
+     * @param epoch Change-feed epoch to look up.
+     * @return std::optional<Type> The value, or nullopt if it is older than the retained history.
+     */
+    [[nodiscard]] std::optional<Type> valueAt(uint64_t epoch) const {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        for (size_t i = 0; i < m_size; ++i) {
+            const auto &slot = m_slots[(m_head + m_slots.size() - 1 - i) % m_slots.size()];
+            if (slot->epoch <= epoch) {
+                return slot->value;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Copy out the retained entries, oldest first.
+     * @return std::vector<HistoryEntry<Type>> Retained entries.
+     */
+    [[nodiscard]] std::vector<HistoryEntry<Type>> entries() const {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        std::vector<HistoryEntry<Type>> result;
+        result.reserve(m_size);
+        for (size_t i = 0; i < m_size; ++i) {
+            result.push_back(*m_slots[(m_head + m_slots.size() - m_size + i) % m_slots.size()]);
+        }
+        return result;
+    }
+
+private:
+    mutable ConditionalMutex m_mutex;                    ///< Protects the ring.
+    std::vector<std::optional<HistoryEntry<Type>>> m_slots; ///< Pre-allocated slots.
+    size_t m_head{0};                                    ///< Next slot to write.
+    size_t m_size{0};                                    ///< Number of valid entries.
+};
+
+/**
+ * @brief Implementation of ObserverNode::~ObserverNode.
+ *
+ * Releases the value history, whose type is only complete here.
+ */
+inline ObserverNode::~ObserverNode() {
+    delete m_history.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Append the current value of a node to its history, if it keeps one.
+ *
+ * @param node Reactive node whose value changed.
+ */
+template <typename Node>
+inline void recordHistory(const Node &node) {
+    using Type = std::remove_cvref_t<decltype(node.getValue())>;
+    if constexpr (!VoidType<Type>) {
+        if (auto *history = node.getHistory()) [[unlikely]] {
+            static_cast<ValueHistory<Type> *>(history)->record(node.getChangeEpoch(), node.getValue());
+        }
+    }
+}
+
+/**
+ * @brief Hand a committed value change to every attached consumer.
+ *
+ * Publishes to the change-event ring and appends to the node's value history.
+ *
+ * @param node Reactive node whose value changed.
+ */
+template <typename Node>
+inline void publishChange(const Node &node) {
+    publishChangeEvent(node);
+    recordHistory(node);
+}
+
+} // namespace reaction
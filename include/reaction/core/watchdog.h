@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/exception.h"
+#include "reaction/core/name_table.h"
+#include "reaction/core/observer_node.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define REACTION_HAS_TSC 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define REACTION_HAS_TSC 0
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Evaluation time budget of one calc node.
+ *
+ * Installed on the node the first time a budget is set and kept until the
+ * node is destroyed, so evaluations can read it without locking.
+ */
+struct TimeBudget {
+    std::atomic<uint64_t> limit{0};    ///< Budget in watchdog ticks, 0 when off.
+    std::atomic<uint32_t> overruns{0}; ///< Evaluations that exceeded the budget.
+    std::atomic<bool> chronic{false};  ///< Whether the node reached the chronic threshold.
+};
+
+/**
+ * @brief Checks whether a node type supports evaluation time budgets.
+ */
+template <typename T>
+concept HasTimeBudget = requires(T &node, std::chrono::nanoseconds budget) {
+    node.setTimeBudget(budget);
+};
+
+/**
+ * @brief A calc evaluation that exceeded its time budget.
+ */
+struct SlowCalcReport {
+    uint64_t nodeId = 0;                   ///< Id of the slow node.
+    std::string_view name;                 ///< Name of the node, empty if unnamed.
+    std::chrono::nanoseconds elapsed{0};   ///< Duration of the evaluation.
+    std::chrono::nanoseconds budget{0};    ///< Budget it exceeded.
+    uint32_t overruns = 0;                 ///< Overruns of this node so far, including this one.
+    bool chronic = false;                  ///< Whether the node is now a chronic offender.
+};
+
+/**
+ * @brief Process-wide watchdog for calc evaluations with a time budget.
+ *
+ * Calcs without a budget pay one relaxed load per evaluation. With a budget,
+ * each evaluation is timed with the time-stamp counter where available
+ * (steady_clock elsewhere) and compared against the budget; only overruns
+ * leave the fast path. The counter rate is calibrated against steady_clock
+ * once, for about 2 ms, when the watchdog is first used.
+ *
+ * An overrun calls the handler on the evaluating thread, after the node's
+ * function lock has been released. A node with as many overruns as the
+ * chronic threshold is marked chronic once and listed by chronicOffenders(),
+ * for the application to move its work to a background executor.
+ */
+class Watchdog {
+public:
+    using Handler = std::function<void(const SlowCalcReport &)>;
+
+    /// @brief Default number of overruns after which a node is chronic.
+    static constexpr uint32_t DEFAULT_CHRONIC_THRESHOLD = 3;
+
+    /**
+     * @brief Get the singleton instance.
+     * @return Watchdog& Reference to the singleton instance.
+     */
+    static Watchdog &getInstance() noexcept {
+        static Watchdog instance;
+        return instance;
+    }
+
+    /**
+     * @brief Set the function called for each overrun.
+     * @param handler Receives the report; an empty handler only counts overruns.
+     */
+    void setHandler(Handler handler) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_handler = std::move(handler);
+    }
+
+    /**
+     * @brief Set after how many overruns a node becomes chronic.
+     * @param threshold Overrun count, 0 to never mark nodes.
+     */
+    void setChronicThreshold(uint32_t threshold) noexcept {
+        m_chronicThreshold.store(threshold, std::memory_order_relaxed);
+    }
+
+    /// @brief Ids of the nodes marked chronic, in the order they were marked.
+    [[nodiscard]] std::vector<uint64_t> chronicOffenders() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_chronic;
+    }
+
+    /// @brief Forget the chronic offenders recorded so far.
+    void clearChronicOffenders() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_chronic.clear();
+    }
+
+    /// @brief Current time in watchdog ticks.
+    static uint64_t ticks() noexcept {
+#if REACTION_HAS_TSC
+        return __rdtsc();
+#else
+        auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+#endif
+    }
+
+    /// @brief Convert a duration to watchdog ticks.
+    [[nodiscard]] uint64_t toTicks(std::chrono::nanoseconds duration) const noexcept {
+        const auto ns = static_cast<double>(std::max<std::chrono::nanoseconds::rep>(duration.count(), 0));
+        return static_cast<uint64_t>(ns * m_ticksPerNs);
+    }
+
+    /// @brief Convert watchdog ticks to a duration.
+    [[nodiscard]] std::chrono::nanoseconds toDuration(uint64_t ticks) const noexcept {
+        return std::chrono::nanoseconds(static_cast<std::chrono::nanoseconds::rep>(static_cast<double>(ticks) / m_ticksPerNs));
+    }
+
+    /**
+     * @brief Check a timed evaluation against its budget.
+     * @param node Node that was evaluated.
+     * @param budget Budget of the node.
+     * @param elapsed Duration of the evaluation in ticks.
+     */
+    void check(const ObserverNode &node, TimeBudget &budget, uint64_t elapsed) {
+        const uint64_t limit = budget.limit.load(std::memory_order_relaxed);
+        if (limit != 0 && elapsed > limit) [[unlikely]] {
+            overrun(node, budget, elapsed, limit);
+        }
+    }
+
+private:
+    Watchdog() : m_ticksPerNs(calibrate()) {}
+    Watchdog(const Watchdog &) = delete;
+    Watchdog &operator=(const Watchdog &) = delete;
+
+    REACTION_COLD void overrun(const ObserverNode &node, TimeBudget &budget, uint64_t elapsed, uint64_t limit) {
+        SlowCalcReport report;
+        report.nodeId = node.getId();
+        report.name = NameTable::getInstance().view(node.getNameHandle());
+        report.elapsed = toDuration(elapsed);
+        report.budget = toDuration(limit);
+        report.overruns = budget.overruns.fetch_add(1, std::memory_order_relaxed) + 1;
+        const uint32_t threshold = m_chronicThreshold.load(std::memory_order_relaxed);
+        report.chronic = threshold != 0 && report.overruns >= threshold;
+
+        Handler handler;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (report.chronic && !budget.chronic.exchange(true, std::memory_order_relaxed)) {
+                m_chronic.push_back(report.nodeId);
+            }
+            handler = m_handler;
+        }
+        if (handler) {
+            handler(report);
+        }
+    }
+
+    /// @brief Measure the tick rate against steady_clock; 1 when ticks are nanoseconds.
+    static double calibrate() {
+#if REACTION_HAS_TSC
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+        const uint64_t startTicks = ticks();
+        while (Clock::now() - start < std::chrono::milliseconds(2)) {
+            std::this_thread::yield();
+        }
+        const uint64_t endTicks = ticks();
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        return ns > 0 && endTicks > startTicks ? static_cast<double>(endTicks - startTicks) / static_cast<double>(ns) : 1.0;
+#else
+        return 1.0;
+#endif
+    }
+
+    const double m_ticksPerNs;                                           ///< Tick rate of ticks().
+    std::atomic<uint32_t> m_chronicThreshold{DEFAULT_CHRONIC_THRESHOLD}; ///< Overruns that make a node chronic.
+    mutable std::mutex m_mutex;                                          ///< Protects m_handler and m_chronic.
+    Handler m_handler;                                                   ///< Called for each overrun.
+    std::vector<uint64_t> m_chronic;                                     ///< Ids of chronic nodes.
+};
+
+} // namespace reaction
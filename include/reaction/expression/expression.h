@@ -27,16 +27,22 @@
 #include "reaction/core/concept.h"
 #include "reaction/core/exception.h"
 #include "reaction/core/resource.h"
+#include "reaction/core/value_history.h"
+#include "reaction/core/watchdog.h"
 #include "reaction/expression/expression_builders.h"
 #include "reaction/expression/expression_types.h"
 #include "reaction/expression/operators.h"
 #include "reaction/graph/field_graph.h"
 #include "reaction/graph/observer_graph.h"
 #include "reaction/policy/trigger.h"
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <shared_mutex>
+#include <tuple>
 #include <vector>
 
 namespace reaction {
@@ -51,6 +57,20 @@ struct VarExpr {};
  */
 struct CalcExpr {};
 
+/**
+ * @brief Marker type for calculated expressions whose function returns Skippable.
+ */
+struct SkipCalcExpr {};
+
+/**
+ * @brief Marker type for one output of a multi-output calc.
+ *
+ * @tparam Tuple Tuple-like result type of the multi-output calc.
+ * @tparam I     Index of the projected element.
+ */
+template <typename Tuple, size_t I>
+struct ProjectExpr {};
+
 // === Forward Declarations ===
 template <typename Expr, typename Type, IsTrigger TR>
 class Expression;
@@ -60,88 +80,63 @@ class Expression;
  *
  * Handles dependency registration, invalidation, and value recomputation.
  *
- * @tparam Type Computed value type.
- * @tparam TR   Triggering mode.
+ * @tparam Type   Computed value type.
+ * @tparam TR     Triggering mode.
+ * @tparam Result Return type of the stored function: Type, or Skippable<Type>.
  */
-template <typename Type, IsTrigger TR>
+template <typename Type, IsTrigger TR, typename Result = Type>
 class CalcExprBase : public Resource<Type>, public TR {
 public:
+    ~CalcExprBase() {
+        delete m_budget.load(std::memory_order_acquire);
+    }
+
     /**
      * @brief Sets the function source and its dependencies transactionally.
      *
-     * This method ensures atomicity: either all changes succeed,
-     * or the node is restored to its original consistent state.
+     * The new function is evaluated first, recording the nodes it reads when
+     * no explicit arguments are given. Only then is the dependency list diffed
+     * against the current one and committed together with the function and
+     * value, so a failure at any step leaves the node untouched and nothing
+     * has to be copied for rollback.
      */
     template <typename F, typename... A>
     void setSource(F &&f, A &&...args) {
-        if constexpr (std::convertible_to<ReturnType<F, A...>, Type>) {
-            // Check if node is involved in any active batch operations
-            auto shared_this = std::static_pointer_cast<CalcExprBase<Type, TR>>(this->shared_from_this());
-            if (ObserverGraph::getInstance().isNodeInActiveBatch(shared_this)) {
-                REACTION_THROW_BATCH_CONFLICT("Reset operations must be performed outside of batch contexts");
-            }
+        if constexpr (std::convertible_to<ReturnType<F, A...>, Result>) {
+            this->ensureOutsideBatch();
 
             ConditionalUniqueLock<ConditionalSharedMutex> lock(m_functionMutex);
 
-            auto originalFun = std::move(m_fun);
-            auto originalValue = [this]() -> std::optional<Type> {
-                if constexpr (!VoidType<Type>) {
-                    // Safely get value without throwing if not initialized
-                    try {
-                        return this->getValue();
-                    } catch (const std::runtime_error &) {
-                        return std::nullopt;
-                    }
+            auto newFun = createFun(std::forward<F>(f), std::forward<A>(args)...);
+            std::vector<NodePtr> dependencies;
+            auto value = [&]() {
+                if constexpr (sizeof...(A) > 0) {
+                    dependencies = {args.getPtr()...};
+                    return newFun();
                 } else {
-                    return std::nullopt;
+                    // Auto-tracked: collect every node the function reads
+                    RegFunGuard g([&dependencies](const NodePtr &node) {
+                        dependencies.push_back(node);
+                    });
+                    return newFun();
                 }
             }();
 
-            auto observerRollback = ObserverGraph::getInstance().saveNodeStateForRollback(shared_this);
-
-            try {
-                // Create new function first
-                auto newFun = createFun(std::forward<F>(f), std::forward<A>(args)...);
-
-                // Update observers with new dependencies
-                this->updateObservers(args.getPtr()...);
+            // Throws on self-observation or cycles without modifying the graph
+            this->rebindSources(dependencies);
 
-                // Replace the function
-                m_fun = std::move(newFun);
-
-                // Now evaluate with the new function
-                if constexpr (!VoidType<Type>) {
-                    this->updateValue(evaluateInternal());
-                } else {
-                    evaluateInternal();
-                }
-
-            } catch (const std::exception &) {
-                // Rollback on failure
-                m_fun = originalFun;
-
-                // Restore original value if it exists
-                if constexpr (!VoidType<Type>) {
-                    if (originalValue.has_value()) {
-                        this->updateValue(*originalValue);
-                    }
+            m_fun = std::move(newFun);
+            if constexpr (!VoidType<Type>) {
+                if (storeResult(std::move(value))) {
+                    this->recordSourceChange();
+                    publishChange(*this);
                 }
-
-                // Restore original observer state
-                observerRollback();
-
-                throw; // Re-throw the original exception
             }
         } else {
             REACTION_THROW_TYPE_MISMATCH(typeid(Type).name(), typeid(ReturnType<F, A...>).name());
         }
     }
 
-    /// @brief Registers an observer for dependency tracking.
-    void addObCb(const NodePtr &node) {
-        this->addOneObserver(node);
-    }
-
     /// @brief Handles value change notifications and trigger checks.
     void valueChanged(bool changed) override {
         handleChange<true>(changed);
@@ -152,6 +147,81 @@ public:
         handleChange<false>(changed);
     }
 
+    /**
+     * @brief Set how long one evaluation of this node may take.
+     *
+     * Evaluations running longer are reported to the Watchdog. Budgets can be
+     * changed or switched off at any time; the overrun count is kept.
+     * @param budget Time budget, zero or negative to switch the check off.
+     */
+    void setTimeBudget(std::chrono::nanoseconds budget) {
+        TimeBudget *current = m_budget.load(std::memory_order_acquire);
+        if (!current) {
+            if (budget.count() <= 0) {
+                return;
+            }
+            auto fresh = std::make_unique<TimeBudget>();
+            if (m_budget.compare_exchange_strong(current, fresh.get(), std::memory_order_acq_rel)) {
+                current = fresh.release();
+            }
+        }
+        const uint64_t limit = budget.count() > 0 ? std::max<uint64_t>(Watchdog::getInstance().toTicks(budget), 1) : 0;
+        current->limit.store(limit, std::memory_order_relaxed);
+    }
+
+    /// @brief Number of evaluations that exceeded the time budget.
+    [[nodiscard]] uint32_t budgetOverruns() const noexcept {
+        const TimeBudget *budget = m_budget.load(std::memory_order_acquire);
+        return budget ? budget->overruns.load(std::memory_order_relaxed) : 0;
+    }
+
+    /// @brief Whether the Watchdog marked this node as a chronic offender.
+    [[nodiscard]] bool isChronicallySlow() const noexcept {
+        const TimeBudget *budget = m_budget.load(std::memory_order_acquire);
+        return budget && budget->chronic.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Recompute a value whose evaluation was deferred to this read.
+     *
+     * Reads are logically const: they only bring the cached value up to date.
+     * Concurrent readers of a dirty node wait for the one recomputing it, and
+     * updates deferred during the recomputation leave the node dirty.
+     */
+    void refreshIfDirty() const
+        requires IsAdaptiveTrig<TR>
+    {
+        TR::recordRead();
+        if constexpr (!VoidType<Type>) {
+            if (!TR::isDirty()) [[likely]] {
+                return;
+            }
+            TimeBudget *budget = activeBudget();
+            uint64_t elapsed = 0;
+            {
+                ConditionalUniqueLock<ConditionalSharedMutex> lock(m_functionMutex);
+                const uint64_t generation = TR::dirtyGeneration();
+                if (!TR::isDirty()) {
+                    return;
+                }
+                auto *self = const_cast<CalcExprBase *>(this);
+                const uint64_t start = budget ? Watchdog::ticks() : 0;
+                auto result = evaluateInternal();
+                if (budget) {
+                    elapsed = Watchdog::ticks() - start;
+                }
+                if (self->storeResult(std::move(result))) {
+                    self->recordDerivedChange();
+                    publishChange(*self);
+                }
+                TR::markClean(generation);
+            }
+            if (budget) [[unlikely]] {
+                Watchdog::getInstance().check(*this, *budget, elapsed);
+            }
+        }
+    }
+
 private:
     /**
      * @brief Captures and wraps a function with weak references to arguments.
@@ -163,13 +233,47 @@ private:
     // - Consider using std::unique_function when available
     template <typename F, typename... A>
     auto createFun(F &&f, A &&...args) {
-        return [f = std::forward<F>(f), ... args = args.getPtr()]() {
-            if constexpr (VoidType<Type>) {
-                std::invoke(f, args->get()...);
-                return Void{};
-            } else {
-                return std::invoke(f, args->get()...);
+        if constexpr (LiftsExpected<std::remove_cvref_t<F>, std::remove_cvref_t<A>...>) {
+            return createLiftedFun(std::forward<F>(f), std::forward<A>(args)...);
+        } else {
+            return [f = std::forward<F>(f), ... args = args.getPtr()]() {
+                if constexpr (VoidType<Type>) {
+                    std::invoke(f, args->get()...);
+                    return Void{};
+                } else {
+                    return std::invoke(f, args->get()...);
+                }
+            };
+        }
+    }
+
+    /**
+     * @brief Wraps a function over plain values so it can read error-valued arguments.
+     *
+     * The function is skipped while any argument holds an error; the first
+     * error becomes this node's value (actions simply do not run).
+     */
+    template <typename F, typename... A>
+    auto createLiftedFun(F &&f, A &&...args) {
+        return [f = std::forward<F>(f), ... args = args.getPtr()]() -> Type {
+            auto values = std::make_tuple(args->get()...);
+            Error error;
+            bool failed = std::apply([&error](const auto &...v) { return (collectError(v, error) || ...); }, values);
+            if (failed) {
+                if constexpr (VoidType<Type>) {
+                    return Void{};
+                } else {
+                    return Type{error};
+                }
             }
+            return std::apply([&f](const auto &...v) -> Type {
+                if constexpr (VoidType<Type>) {
+                    std::invoke(f, unwrapExpected(v)...);
+                    return Void{};
+                } else {
+                    return std::invoke(f, unwrapExpected(v)...);
+                }
+            }, values);
         };
     }
 
@@ -179,10 +283,31 @@ private:
             this->setChanged(changed);
         }
 
+        if constexpr (IsAdaptiveTrig<TR> && !VoidType<Type>) {
+            // A lazy node only owes its readers a recomputation
+            if (TR::checkTrig() && TR::deferUpdate()) {
+                if constexpr (Notify) {
+                    this->notify(true);
+                }
+                return;
+            }
+        }
+
         if (TR::checkTrig()) {
             bool change = true;
             if constexpr (!VoidType<Type>) {
-                change = this->updateValue(evaluate());
+                auto result = evaluate();
+                if constexpr (IsSkippable<Result>) {
+                    // A skip vetoes propagation: observers are not even told "unchanged"
+                    if (!result) {
+                        return;
+                    }
+                }
+                change = storeResult(std::move(result));
+                if (change) {
+                    this->recordDerivedChange();
+                    publishChange(*this);
+                }
             } else {
                 evaluate();
             }
@@ -192,8 +317,36 @@ private:
         }
     }
 
-    /// @brief Thread-safe evaluation of the current expression.
+    /// @brief Store the result of an evaluation; a skip leaves the value as is.
+    bool storeResult(Result &&result) {
+        if constexpr (IsSkippable<Result>) {
+            return result && this->updateValue(*std::move(result));
+        } else {
+            return this->updateValue(std::move(result));
+        }
+    }
+
+    /// @brief Budget of this node if its check is switched on, else nullptr.
+    TimeBudget *activeBudget() const noexcept {
+        TimeBudget *budget = m_budget.load(std::memory_order_acquire);
+        return budget && budget->limit.load(std::memory_order_relaxed) != 0 ? budget : nullptr;
+    }
+
+    /// @brief Evaluate the current expression, timing it against the budget if one is set.
     auto evaluate() const {
+        TimeBudget *budget = activeBudget();
+        if (!budget) [[likely]] {
+            return evaluateLocked();
+        }
+        const uint64_t start = Watchdog::ticks();
+        auto result = evaluateLocked();
+        // Reported after the function lock is released, so handlers may read this node
+        Watchdog::getInstance().check(*this, *budget, Watchdog::ticks() - start);
+        return result;
+    }
+
+    /// @brief Thread-safe evaluation of the current expression.
+    auto evaluateLocked() const {
         // Fast path: try lock-free read for performance-critical path
         if (ThreadManager::getInstance().isThreadSafetyEnabled()) {
             ConditionalSharedLock<ConditionalSharedMutex> lock(m_functionMutex);
@@ -222,8 +375,9 @@ private:
         }
     }
 
-    mutable ConditionalSharedMutex m_functionMutex; ///< Conditional mutex for thread-safe function access.
-    std::function<Type()> m_fun;
+    mutable ConditionalSharedMutex m_functionMutex{LockClass::FUNCTION}; ///< Conditional mutex for thread-safe function access.
+    std::function<Result()> m_fun;
+    std::atomic<TimeBudget *> m_budget{nullptr}; ///< Evaluation time budget, installed by the first setTimeBudget().
 };
 
 /**
@@ -235,6 +389,13 @@ template <typename Expr, typename Type, IsTrigger TR>
 class Expression : public CalcExprBase<Type, TR> {
 };
 
+/**
+ * @brief Expression specialization for calcs that may skip an evaluation.
+ */
+template <typename Type, IsTrigger TR>
+class Expression<SkipCalcExpr, Type, TR> : public CalcExprBase<Type, TR, Skippable<Type>> {
+};
+
 /**
  * @brief Expression specialization for reactive variables.
  *
@@ -248,12 +409,60 @@ public:
     template <typename T>
     void setValue(T &&t) {
         bool changed = this->updateValue(std::forward<T>(t));
+        if (changed) {
+            this->recordSourceChange();
+            publishChange(*this);
+        }
         if (!g_batch_execute) {
             this->notify(changed);
         }
     }
 };
 
+/**
+ * @brief Expression specialization for one output of a multi-output calc.
+ *
+ * Observes the calc computing the whole tuple and keeps a copy of element I.
+ * Recomputing it copies just that element, and only a changed element
+ * notifies the output's observers.
+ */
+template <typename Tuple, size_t I, typename Type, IsTrigger TR>
+class Expression<ProjectExpr<Tuple, I>, Type, TR> : public Resource<Type> {
+public:
+    explicit Expression(std::shared_ptr<const Resource<Tuple>> source)
+        : Resource<Type>(source->readValue(project)), m_source(std::move(source)) {
+    }
+
+    /// @brief Handles value change notifications of the source calc.
+    void valueChanged(bool changed) override {
+        this->notify(handleChange(changed));
+    }
+
+    /// @brief Handles value change of the source calc without notifications.
+    void changedNoNotify(bool changed) override {
+        handleChange(changed);
+    }
+
+private:
+    static Type project(const Tuple &tuple) {
+        return std::get<I>(tuple);
+    }
+
+    bool handleChange(bool changed) {
+        if (!changed) {
+            return false;
+        }
+        if (this->updateValue(m_source->readValue(project))) {
+            this->recordDerivedChange();
+            publishChange(*this);
+            return true;
+        }
+        return false;
+    }
+
+    std::shared_ptr<const Resource<Tuple>> m_source; ///< Calc computing the whole tuple.
+};
+
 /**
  * @brief Expression specialization for binary expressions.
  */
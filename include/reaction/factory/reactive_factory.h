@@ -43,6 +43,32 @@ using Calc = React<CalcExpr, SrcType, IV, TR>;
 template <IsInvalidation IV = KeepHandle, IsTrigger TR = ChangeTrig>
 using Action = React<CalcExpr, Void, IV, TR>;
 
+/**
+ * @brief Alias template for a calc whose function returns Skippable<SrcType>.
+ *
+ * @tparam SrcType The underlying data type produced by this reactive calculation.
+ * @tparam IV Invalidation strategy, default is KeepHandle.
+ * @tparam TR Trigger mode, default is ChangeTrig.
+ */
+template <NonReact SrcType, IsInvalidation IV = KeepHandle, IsTrigger TR = ChangeTrig>
+using SkipCalc = React<SkipCalcExpr, SrcType, IV, TR>;
+
+/**
+ * @brief Expression marker of a calc node with the given function result type.
+ */
+template <typename Result>
+using CalcExprFor = std::conditional_t<IsSkippable<Result>, SkipCalcExpr, CalcExpr>;
+
+/**
+ * @brief Alias template for one output of a multi-output calc (see multiCalc()).
+ *
+ * @tparam Tuple Tuple-like result type of the multi-output calc.
+ * @tparam I     Index of the output.
+ * @tparam IV    Invalidation strategy, default is KeepHandle.
+ */
+template <typename Tuple, size_t I, IsInvalidation IV = KeepHandle>
+using Output = React<ProjectExpr<Tuple, I>, std::tuple_element_t<I, Tuple>, IV, ChangeTrig>;
+
 /**
  * @brief Base class representing a field container in the reactive graph.
  */
@@ -96,6 +122,7 @@ private:
  */
 template <IsTrigger TR = ChangeTrig, IsInvalidation IV = KeepHandle, NonReact SrcType>
 auto constVar(SrcType &&t) {
+    AllocScope scope(AllocSubsystem::CREATION);
     auto ptr = std::make_shared<ReactImpl<VarExpr, const std::remove_cvref_t<SrcType>, IV, TR>>(std::forward<SrcType>(t));
     ObserverGraph::getInstance().addNode(ptr);
     return React{ptr};
@@ -116,6 +143,7 @@ auto constVar(SrcType &&t) {
 template <IsTrigger TR = ChangeTrig, IsInvalidation IV = KeepHandle, NonReact SrcType>
 auto var(SrcType &&t) {
     REACTION_REGISTER_THREAD();
+    AllocScope scope(AllocSubsystem::CREATION);
     auto ptr = std::make_shared<ReactImpl<VarExpr, std::remove_cvref_t<SrcType>, IV, TR>>(std::forward<SrcType>(t));
     ObserverGraph::getInstance().addNode(ptr);
     if constexpr (HasField<SrcType>) {
@@ -139,6 +167,7 @@ auto var(SrcType &&t) {
 template <IsTrigger TR = ChangeTrig, IsInvalidation IV = KeepHandle, IsOpExpr OpExpr>
 auto expr(OpExpr &&opExpr) {
     REACTION_REGISTER_THREAD();
+    AllocScope scope(AllocSubsystem::CREATION);
     auto ptr = std::make_shared<ReactImpl<CalcExpr, std::remove_cvref_t<OpExpr>, IV, TR>>(std::forward<OpExpr>(opExpr));
     ObserverGraph::getInstance().addNode(ptr);
     ptr->set();
@@ -149,6 +178,8 @@ auto expr(OpExpr &&opExpr) {
  * @brief Create a reactive calculation based on a callable and its arguments.
  *
  * Registers the node to ObserverGraph and immediately sets (evaluates) the calculation.
+ * A callable returning Skippable<T> creates a node of type T that can veto
+ * propagation by returning reaction::skip.
  *
  * @tparam TR Trigger mode, default is ChangeTrig.
  * @tparam IV Invalidation strategy, default is KeepHandle.
@@ -156,17 +187,62 @@ auto expr(OpExpr &&opExpr) {
  * @tparam Args Argument types for the callable.
  * @param fun The callable to invoke reactively.
  * @param args Arguments to forward to the callable.
- * @return React<CalcExpr, ReturnType<Fun, Args...>, IV, TR> Reactive calculation wrapper.
+ * @return React<CalcExprFor<R>, UnwrapSkippable<R>, IV, TR> Reactive calculation wrapper, R being ReturnType<Fun, Args...>.
  */
 template <IsTrigger TR = ChangeTrig, IsInvalidation IV = KeepHandle, typename Fun, typename... Args>
 auto calc(Fun &&fun, Args &&...args) {
     REACTION_REGISTER_THREAD();
-    auto ptr = std::make_shared<ReactImpl<CalcExpr, ReturnType<Fun, Args...>, IV, TR>>();
+    AllocScope scope(AllocSubsystem::CREATION);
+    using Result = ReturnType<Fun, Args...>;
+    auto ptr = std::make_shared<ReactImpl<CalcExprFor<Result>, UnwrapSkippable<Result>, IV, TR>>();
     ObserverGraph::getInstance().addNode(ptr);
     ptr->set(std::forward<Fun>(fun), std::forward<Args>(args)...);
     return React{ptr};
 }
 
+/**
+ * @brief Create a calc whose result is split into one reactive handle per element.
+ *
+ * The callable returns a tuple-like value (std::tuple, std::pair, std::array or
+ * any type implementing the tuple protocol), optionally wrapped in Skippable,
+ * and runs once per change of its inputs. Each element is exposed as its own node that is only marked changed,
+ * and only notifies its observers, when that element differs from its previous
+ * value.
+ *
+ * The node computing the whole result has no handle of its own; it stays in
+ * the graph until one of its inputs is closed, which closes it and every
+ * output with it.
+ *
+ * @tparam TR Trigger mode of the computation, default is ChangeTrig.
+ * @tparam IV Invalidation strategy of the outputs, default is KeepHandle.
+ * @tparam Fun Callable type.
+ * @tparam Args Argument types for the callable.
+ * @param fun The callable to invoke reactively.
+ * @param args Arguments to forward to the callable.
+ * @return std::tuple of Output handles, suitable for structured bindings.
+ */
+template <IsTrigger TR = ChangeTrig, IsInvalidation IV = KeepHandle, typename Fun, typename... Args>
+    requires(!IsAdaptiveTrig<TR>)
+auto multiCalc(Fun &&fun, Args &&...args) {
+    using Result = ReturnType<Fun, Args...>;
+    using Tuple = UnwrapSkippable<Result>;
+    REACTION_REGISTER_THREAD();
+    AllocScope scope(AllocSubsystem::CREATION);
+    auto &graph = ObserverGraph::getInstance();
+    auto source = std::make_shared<ReactImpl<CalcExprFor<Result>, Tuple, KeepHandle, TR>>();
+    graph.addNode(source);
+    source->set(std::forward<Fun>(fun), std::forward<Args>(args)...);
+    return [&]<size_t... I>(std::index_sequence<I...>) {
+        auto output = [&]<size_t Index>(std::integral_constant<size_t, Index>) {
+            auto ptr = std::make_shared<ReactImpl<ProjectExpr<Tuple, Index>, std::tuple_element_t<Index, Tuple>, IV, ChangeTrig>>(source);
+            graph.addNode(ptr);
+            graph.addObserver(ptr, source);
+            return React{ptr};
+        };
+        return std::tuple{output(std::integral_constant<size_t, I>{})...};
+    }(std::make_index_sequence<std::tuple_size_v<Tuple>>{});
+}
+
 /**
  * @brief Alias for calc(), used to create a reactive action.
  *
@@ -234,6 +310,7 @@ auto create(Fun &&fun, Args &&...args) {
  */
 template <InvocableType Fun>
 auto batch(Fun &&fun) {
+    AllocScope scope(AllocSubsystem::BATCH);
     return Batch{std::forward<Fun>(fun)};
 }
 
@@ -248,8 +325,34 @@ auto batch(Fun &&fun) {
  */
 template <InvocableType Fun>
 void batchExecute(Fun &&fun) {
+    AllocScope scope(AllocSubsystem::BATCH);
     Batch batch{std::forward<Fun>(fun)};
     batch.execute();
 }
 
+/**
+ * @brief Lays the current graph out for propagation.
+ *
+ * Builds a snapshot of the graph with nodes numbered in topological order and
+ * observer lists stored contiguously; propagation walks it until the graph
+ * structure next changes. Call after building or rebuilding a graph.
+ *
+ * @return size_t Number of nodes in the snapshot.
+ */
+inline size_t compact() {
+    return ObserverGraph::getInstance().compact();
+}
+
+/**
+ * @brief Keep the compact layout current across subscriptions, resets and closes.
+ *
+ * Every structural edit republishes the snapshot once it is done, while
+ * propagations in flight finish on the one they started with.
+ *
+ * @param enabled Whether to republish after each edit.
+ */
+inline void autoCompact(bool enabled = true) {
+    ObserverGraph::getInstance().setAutoCompact(enabled);
+}
+
 } // namespace reaction
@@ -10,10 +10,14 @@
 #include "reaction/concurrency/global_state.h"
 #include "reaction/core/observer_node.h"
 #include "reaction/core/types.h"
+#include "reaction/graph/change_feed.h"
+#include "reaction/graph/dirty_bitmap.h"
 #include "reaction/graph/observer_graph.h"
 #include <atomic>
 #include <iostream>
 #include <set>
+#include <type_traits>
+#include <vector>
 
 namespace reaction {
 
@@ -42,6 +46,66 @@ struct BatchCompare {
     }
 };
 
+/**
+ * @brief Recomputes the cone below written nodes over the compact topology.
+ *
+ * Dense indices are in topological order, so marking observers in a
+ * DirtyBitmap and draining it in ascending order recomputes every node of
+ * the cone exactly once, after all of its dependencies. Marking, deduplicating
+ * and ordering are word operations instead of hash set inserts and a sort by
+ * depth.
+ */
+struct CompactPropagation {
+    /**
+     * @brief Recompute everything downstream of the given nodes without notifications.
+     * @param sources Written nodes, as NodePtr or NodeWeak.
+     * @param dirty Scratch bitmap, reused across calls.
+     * @return false, without recomputing anything, if no current topology covers every source.
+     */
+    template <typename Range>
+    static bool run(const Range &sources, DirtyBitmap &dirty) {
+        auto &graph = ObserverGraph::getInstance();
+        if (!graph.hasCompactTopology()) return false;
+        EpochGuard epoch;
+        const CompactTopology *topology = graph.currentTopology();
+        if (!topology) return false;
+
+        if (dirty.size() != topology->nodes.size()) {
+            dirty.resize(topology->nodes.size());
+        } else {
+            // Left over if a previous run threw
+            dirty.clear();
+        }
+        for (const auto &source : sources) {
+            NodePtr node;
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(source)>, NodeWeak>) {
+                node = source.lock();
+            } else {
+                node = source;
+            }
+            if (!node) continue;
+            const uint32_t index = node->m_denseIndex.load(std::memory_order_relaxed);
+            if (!topology->contains(node.get(), index)) {
+                dirty.clear();
+                return false;
+            }
+            markObservers(*topology, index, dirty);
+        }
+        dirty.drain([&](size_t index) {
+            markObservers(*topology, static_cast<uint32_t>(index), dirty);
+            topology->nodes[index]->changedNoNotify();
+        });
+        return true;
+    }
+
+private:
+    static void markObservers(const CompactTopology &topology, uint32_t index, DirtyBitmap &dirty) noexcept {
+        for (uint32_t observer : topology.observersOf(index)) {
+            dirty.set(observer);
+        }
+    }
+};
+
 /**
  * @brief Represents a batch operation that tracks and manages observer nodes.
  *
@@ -64,8 +128,10 @@ public:
      * 4. Registers this batch as active to prevent reset operations
      */
     template <InvocableType F>
-    Batch(F &&f) : m_fun(std::forward<F>(f)), m_batchId(this) {
+    Batch(F &&f) : m_fun(std::forward<F>(f)) {
+        AllocScope scope(AllocSubsystem::BATCH);
         BatchFunGuard g([this](const NodePtr &node) {
+            m_sources.push_back(node);
             // collectObservers now uses caching internally
             ObserverGraph::getInstance().collectObservers(node, m_observers);
         });
@@ -78,7 +144,7 @@ public:
         }
 
         // Register this batch as active to protect nodes from reset operations
-        ObserverGraph::getInstance().registerActiveBatch(m_batchId, m_observers);
+        ObserverGraph::getInstance().registerActiveBatch(m_observers);
     }
 
     /**
@@ -91,7 +157,7 @@ public:
         if (!m_isClosed) {
             // Only unregister if we haven't already closed
             m_isClosed = true;
-            ObserverGraph::getInstance().unregisterActiveBatch(m_batchId);
+            ObserverGraph::getInstance().unregisterActiveBatch(m_observers);
         }
     }
 
@@ -112,7 +178,7 @@ public:
         if (!m_isClosed) {
             // Only unregister if we haven't already closed
             m_isClosed = true;
-            ObserverGraph::getInstance().unregisterActiveBatch(m_batchId);
+            ObserverGraph::getInstance().unregisterActiveBatch(m_observers);
         }
     }
 
@@ -129,12 +195,19 @@ public:
      * @brief Execute the batch operation.
      *
      * 1. Invokes the stored function
-     * 2. Triggers valueChanged() on all collected observer nodes
+     * 2. Triggers changedNoNotify() on all collected observer nodes, walking
+     *    the compact topology with a dirty bitmap when one is current
      */
     void execute() {
+        AllocScope scope(AllocSubsystem::BATCH);
+        // All writes of one batch execution share a single change-feed epoch
+        ChangeFeed::getInstance().advance();
         BatchExeGuard g(true);
         std::invoke(m_fun);
 
+        if (CompactPropagation::run(m_sources, m_dirty)) {
+            return;
+        }
         for (auto &node : m_batchNodes) {
             if (auto wp = node.lock()) [[likely]]
                 wp->changedNoNotify();
@@ -143,10 +216,102 @@ public:
 
 private:
     NodeSet m_observers;                                ///< Collection of observer nodes accessed during batch
+    std::vector<NodeWeak> m_sources;                    ///< Nodes written by the batch function
     std::multiset<NodeWeak, BatchCompare> m_batchNodes; ///< Nodes tracked by this batch, ordered by depth
+    DirtyBitmap m_dirty;                                ///< Scratch bitmap for compact propagation
     std::function<void()> m_fun;                        ///< The function to execute for this batch
-    const void *m_batchId;                              ///< Unique identifier for this batch instance
     bool m_isClosed{false};                             ///< Whether the batch has been manually closed
 };
 
+/**
+ * @brief Groups many calc resets into one downstream propagation.
+ *
+ * While a transaction is open on the current thread, each reset() still
+ * rebinds and re-evaluates its own node immediately, but the downstream
+ * recomputation is deferred. On commit the observers of every reset node are
+ * collected once, ordered by depth and recomputed a single time each, so
+ * re-binding N calcs that share descendants costs one pass instead of N.
+ *
+ * Transactions nest: an inner transaction hands its nodes to the outer one.
+ * Resets applied before an exception are still propagated when the scope ends.
+ */
+class GraphTransaction {
+public:
+    GraphTransaction() : m_outer(g_graph_transaction) {
+        g_graph_transaction = this;
+    }
+
+    ~GraphTransaction() {
+        REACTION_TRY {
+            commit();
+        } REACTION_CATCH(...) {
+            // Propagation errors are reported by an explicit commit()
+        }
+    }
+
+    GraphTransaction(const GraphTransaction &) = delete;
+    GraphTransaction &operator=(const GraphTransaction &) = delete;
+
+    /**
+     * @brief Record a reset node whose observers must be recomputed.
+     * @param node The node that was re-bound.
+     */
+    void defer(const NodePtr &node) {
+        m_nodes.push_back(node);
+    }
+
+    /**
+     * @brief Close the transaction and propagate all deferred resets.
+     *
+     * Calling commit() more than once has no effect after the first call.
+     */
+    void commit() {
+        if (m_committed) return;
+        m_committed = true;
+        g_graph_transaction = m_outer;
+
+        if (m_outer) {
+            for (auto &node : m_nodes) {
+                m_outer->defer(node);
+            }
+            return;
+        }
+
+        // The whole transaction is one change-feed epoch, like a batch execution
+        ChangeFeed::getInstance().advance();
+        BatchExeGuard g(true);
+        DirtyBitmap dirty;
+        if (CompactPropagation::run(m_nodes, dirty)) {
+            return;
+        }
+
+        NodeSet observers;
+        for (auto &node : m_nodes) {
+            ObserverGraph::getInstance().collectObservers(node, observers);
+        }
+        std::multiset<NodeWeak, BatchCompare> ordered(observers.begin(), observers.end());
+        for (auto &node : ordered) {
+            if (auto wp = node.lock()) [[likely]]
+                wp->changedNoNotify();
+        }
+    }
+
+private:
+    GraphTransaction *m_outer;   ///< Enclosing transaction, if any.
+    std::vector<NodePtr> m_nodes; ///< Nodes reset inside this transaction.
+    bool m_committed{false};     ///< Whether commit() has run.
+};
+
+/**
+ * @brief Run a function inside a GraphTransaction and commit it.
+ *
+ * @param f Function performing the resets.
+ */
+template <InvocableType F>
+void rebindAll(F &&f) {
+    GraphTransaction transaction;
+    std::invoke(std::forward<F>(f));
+    transaction.commit();
+}
+
 } // namespace reaction
\ No newline at end of file
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/concurrency/global_state.h"
+#include "reaction/concurrency/thread_manager.h"
+#include "reaction/core/observer_node.h"
+#include "reaction/core/types.h"
+#include "reaction/graph/observer_graph.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Versioned change feed backed by a global logical clock.
+ *
+ * Every source write (Var assignment, compound operator, reset) advances the
+ * clock by one epoch; a batch execution shares a single epoch. Each node that
+ * actually changes is stamped with the epoch of the write that caused it, so
+ * consumers can poll "what changed since epoch N" at their own rate instead of
+ * attaching an Action to every node.
+ *
+ * The per-node stamp costs one atomic store on the propagation path. Global
+ * queries over all nodes can optionally be backed by a bounded dirty log that
+ * records each node at most once per epoch; without the log (or once it has
+ * wrapped past the requested epoch) they fall back to scanning the graph.
+ */
+class ChangeFeed {
+public:
+    /**
+     * @brief Get the singleton instance of the change feed.
+     * @return ChangeFeed& singleton reference.
+     */
+    [[nodiscard]] static ChangeFeed &getInstance() noexcept {
+        static ChangeFeed instance;
+        return instance;
+    }
+
+    /// @brief Current epoch of the logical clock.
+    [[nodiscard]] uint64_t now() const noexcept {
+        return m_epoch.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Open a new epoch.
+     * @return uint64_t The new current epoch.
+     */
+    uint64_t advance() noexcept {
+        return m_epoch.fetch_add(1, std::memory_order_acq_rel) + 1;
+    }
+
+    /**
+     * @brief Enable the dirty log with a fixed capacity.
+     *
+     * The log is pre-allocated; once full, the oldest entries are overwritten.
+     * @param capacity Maximum number of (epoch, node) entries retained.
+     */
+    void enableLog(size_t capacity) {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_logMutex);
+        m_log.assign(capacity, LogEntry{});
+        m_logHead = 0;
+        m_logSize = 0;
+        m_truncatedEpoch = now();
+        m_logEnabled.store(capacity > 0, std::memory_order_release);
+    }
+
+    /// @brief Disable the dirty log and release its storage.
+    void disableLog() {
+        m_logEnabled.store(false, std::memory_order_release);
+        ConditionalUniqueLock<ConditionalMutex> lock(m_logMutex);
+        m_log.clear();
+        m_log.shrink_to_fit();
+        m_logHead = 0;
+        m_logSize = 0;
+    }
+
+    /**
+     * @brief Stamp a node that changed and append it to the dirty log.
+     *
+     * @param node Node whose value changed.
+     * @param source Whether the change is a direct write rather than a propagated one.
+     */
+    void record(ObserverNode &node, bool source) {
+        const uint64_t epoch = (source && !g_batch_execute) ? advance() : now();
+        const uint64_t previous = node.m_changeEpoch.exchange(epoch, std::memory_order_acq_rel);
+        if (previous != epoch && m_logEnabled.load(std::memory_order_relaxed)) [[unlikely]] {
+            append(epoch, node);
+        }
+    }
+
+    /**
+     * @brief Collect all nodes changed after the given epoch.
+     *
+     * @param epoch Epoch previously obtained from now().
+     * @return std::vector<NodePtr> Nodes whose last change is newer than epoch.
+     */
+    [[nodiscard]] std::vector<NodePtr> changedSince(uint64_t epoch) const {
+        std::vector<NodePtr> result;
+        if (m_logEnabled.load(std::memory_order_acquire)) {
+            ConditionalUniqueLock<ConditionalMutex> lock(m_logMutex);
+            if (epoch >= m_truncatedEpoch) {
+                std::unordered_set<const ObserverNode *> seen;
+                for (size_t i = 0; i < m_logSize; ++i) {
+                    const auto &entry = m_log[(m_logHead + m_log.size() - 1 - i) % m_log.size()];
+                    if (entry.epoch <= epoch) break;
+                    if (auto node = entry.node.lock(); node && seen.insert(node.get()).second) {
+                        result.push_back(std::move(node));
+                    }
+                }
+                return result;
+            }
+        }
+
+        ObserverGraph::getInstance().forEachNode([&](const NodePtr &node) {
+            if (node->getChangeEpoch() > epoch) {
+                result.push_back(node);
+            }
+        });
+        return result;
+    }
+
+    /**
+     * @brief Collect the names of named nodes changed after the given epoch.
+     *
+     * @param epoch Epoch previously obtained from now().
+     * @return std::vector<std::string> Names of the changed nodes.
+     */
+    [[nodiscard]] std::vector<std::string> changedNamesSince(uint64_t epoch) const {
+        std::vector<std::string> result;
+        ObserverGraph::getInstance().forEachNamedNode([&](const NodePtr &node, std::string_view name) {
+            if (node->getChangeEpoch() > epoch) {
+                result.emplace_back(name);
+            }
+        });
+        return result;
+    }
+
+private:
+    ChangeFeed() = default;
+
+    /**
+     * @brief Entry of the dirty log.
+     */
+    struct LogEntry {
+        uint64_t epoch = 0; ///< Epoch of the change.
+        NodeWeak node;      ///< Node that changed.
+    };
+
+    /**
+     * @brief Append an entry to the dirty log, overwriting the oldest one when full.
+     */
+    void append(uint64_t epoch, ObserverNode &node) {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_logMutex);
+        if (m_log.empty()) return;
+        auto &slot = m_log[m_logHead];
+        if (m_logSize == m_log.size()) {
+            m_truncatedEpoch = std::max(m_truncatedEpoch, slot.epoch);
+        } else {
+            ++m_logSize;
+        }
+        slot.epoch = epoch;
+        slot.node = node.weak_from_this();
+        m_logHead = (m_logHead + 1) % m_log.size();
+    }
+
+    std::atomic<uint64_t> m_epoch{0};        ///< Global logical clock.
+    std::atomic<bool> m_logEnabled{false};   ///< Whether changes are appended to the dirty log.
+    mutable ConditionalMutex m_logMutex;     ///< Protects the dirty log.
+    std::vector<LogEntry> m_log;             ///< Pre-allocated ring of dirty entries.
+    size_t m_logHead{0};                     ///< Next slot to write.
+    size_t m_logSize{0};                     ///< Number of valid entries.
+    uint64_t m_truncatedEpoch{0};            ///< Newest epoch lost to overwriting.
+};
+
+/**
+ * @brief Implementation of ObserverNode::recordSourceChange.
+ */
+inline void ObserverNode::recordSourceChange() {
+    ChangeFeed::getInstance().record(*this, true);
+}
+
+/**
+ * @brief Implementation of ObserverNode::recordDerivedChange.
+ */
+inline void ObserverNode::recordDerivedChange() {
+    ChangeFeed::getInstance().record(*this, false);
+}
+
+} // namespace reaction
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/types.h"
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Immutable, densely indexed snapshot of the observer graph.
+ *
+ * Nodes are numbered in topological (breadth-first) order and the observer
+ * lists of all nodes are stored back to back in compressed sparse row form,
+ * each list sorted by index. Propagation over the snapshot therefore reads
+ * two contiguous arrays in roughly ascending order instead of chasing the
+ * hash buckets of every node's observer set.
+ *
+ * The snapshot keeps its nodes alive and is only used while the graph
+ * structure version it was built from is current.
+ */
+struct CompactTopology {
+    static constexpr uint32_t NO_INDEX = std::numeric_limits<uint32_t>::max();
+
+    std::vector<NodePtr> nodes;      ///< Dense node table in topological order.
+    std::vector<uint32_t> offsets;   ///< Observers of nodes[i] are observers[offsets[i], offsets[i + 1]).
+    std::vector<uint32_t> observers; ///< Concatenated observer lists, as node table indices.
+    uint64_t version = 0;            ///< Graph structure version the snapshot was built from.
+
+    /// @brief Whether index is the dense index of node in this snapshot.
+    [[nodiscard]] bool contains(const ObserverNode *node, uint32_t index) const noexcept {
+        return index < nodes.size() && nodes[index].get() == node;
+    }
+
+    /// @brief Observer indices of the node at index.
+    [[nodiscard]] std::span<const uint32_t> observersOf(uint32_t index) const noexcept {
+        return {observers.data() + offsets[index], observers.data() + offsets[index + 1]};
+    }
+};
+
+} // namespace reaction
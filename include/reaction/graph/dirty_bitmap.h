@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Two-level bitset of dirty dense node indices.
+ *
+ * The lower level holds one bit per node, the summary level one bit per
+ * non-zero lower word. Marking is a pair of ORs, and finding, counting or
+ * clearing the marked indices only touches words that hold any, so the cost
+ * of a sparse change set is independent of the size of the graph.
+ */
+class DirtyBitmap {
+public:
+    DirtyBitmap() = default;
+
+    /// @brief Create an empty bitmap for indices below bits.
+    explicit DirtyBitmap(size_t bits) {
+        resize(bits);
+    }
+
+    /**
+     * @brief Resize to hold indices below bits and clear every mark.
+     * @param bits Number of indices.
+     */
+    void resize(size_t bits) {
+        m_size = bits;
+        m_words.assign((bits + 63) / 64, 0);
+        m_summary.assign((m_words.size() + 63) / 64, 0);
+    }
+
+    /// @brief Number of indices the bitmap holds.
+    [[nodiscard]] size_t size() const noexcept {
+        return m_size;
+    }
+
+    /**
+     * @brief Mark an index.
+     * @param index Index below size().
+     * @return true if the index was not marked before.
+     */
+    bool set(size_t index) noexcept {
+        const size_t word = index >> 6;
+        const uint64_t bit = uint64_t{1} << (index & 63);
+        const bool fresh = (m_words[word] & bit) == 0;
+        m_words[word] |= bit;
+        m_summary[word >> 6] |= uint64_t{1} << (word & 63);
+        return fresh;
+    }
+
+    /// @brief Whether an index is marked.
+    [[nodiscard]] bool test(size_t index) const noexcept {
+        return (m_words[index >> 6] >> (index & 63)) & 1;
+    }
+
+    /// @brief Whether no index is marked.
+    [[nodiscard]] bool empty() const noexcept {
+        for (uint64_t summary : m_summary) {
+            if (summary) return false;
+        }
+        return true;
+    }
+
+    /// @brief Number of marked indices.
+    [[nodiscard]] size_t count() const noexcept {
+        size_t total = 0;
+        forEachWord([&](size_t word) { total += static_cast<size_t>(std::popcount(m_words[word])); });
+        return total;
+    }
+
+    /// @brief Unmark every index.
+    void clear() noexcept {
+        forEachWord([&](size_t word) { m_words[word] = 0; });
+        for (uint64_t &summary : m_summary) summary = 0;
+    }
+
+    /**
+     * @brief Visit the marked indices in ascending order.
+     * @param f Callable invoked with each index; must not modify the bitmap.
+     */
+    template <typename F>
+    void forEach(F &&f) const {
+        forEachWord([&](size_t word) {
+            for (uint64_t bits = m_words[word]; bits; bits &= bits - 1) {
+                f(word * 64 + static_cast<size_t>(std::countr_zero(bits)));
+            }
+        });
+    }
+
+    /**
+     * @brief Unmark and visit indices in ascending order until none is left.
+     *
+     * The callable may mark further indices above the one being visited,
+     * which are visited in turn; this is how a cone is walked when indices
+     * are in topological order. Marks below the visited index break the
+     * ordering and may be left for a later call.
+     * @param f Callable invoked with each index.
+     */
+    template <typename F>
+    void drain(F &&f) {
+        for (size_t group = 0; group < m_summary.size(); ++group) {
+            while (m_summary[group]) {
+                const size_t word = group * 64 + static_cast<size_t>(std::countr_zero(m_summary[group]));
+                while (m_words[word]) {
+                    const size_t bit = static_cast<size_t>(std::countr_zero(m_words[word]));
+                    m_words[word] &= m_words[word] - 1;
+                    f(word * 64 + bit);
+                }
+                m_summary[group] &= ~(uint64_t{1} << (word & 63));
+            }
+        }
+    }
+
+private:
+    /// @brief Visit the indices of the non-zero lower words in ascending order.
+    template <typename F>
+    void forEachWord(F &&f) const {
+        for (size_t group = 0; group < m_summary.size(); ++group) {
+            for (uint64_t bits = m_summary[group]; bits; bits &= bits - 1) {
+                f(group * 64 + static_cast<size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+
+    size_t m_size = 0;               ///< Number of indices.
+    std::vector<uint64_t> m_words;   ///< One bit per index.
+    std::vector<uint64_t> m_summary; ///< One bit per non-zero word of m_words.
+};
+
+} // namespace reaction
@@ -8,14 +8,21 @@
 #pragma once
 
 #include "reaction/cache/graph_cache.h"
+#include "reaction/concurrency/epoch.h"
 #include "reaction/concurrency/thread_manager.h"
 #include "reaction/core/exception.h"
 #include "reaction/core/types.h"
+#include "reaction/graph/compact_topology.h"
+#include "reaction/memory/graph_memory.h"
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <mutex>
-#include <set>
 #include <shared_mutex>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
@@ -60,6 +67,7 @@ public:
      */
     void addObserver(const NodePtr &source, const NodePtr &target) {
         REACTION_REGISTER_THREAD();
+        TopologyRefresh refresh(*this);
         ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
 
         if (source == target) {
@@ -87,50 +95,38 @@ public:
             target->m_observers.insert(source);
         }
 
-        // Invalidate all caches due to graph structure change
-        m_graphCache.invalidateAll();
-        m_cycleCache.invalidateAll();
-        m_metricsCache.invalidateAll();
+        structureChanged();
     }
 
     /**
      * @brief Register a batch operation that affects specific nodes.
      *
-     * This method tracks which nodes are currently involved in active batch operations.
-     * Reset operations on these nodes will be prevented or delayed.
+     * Each affected node carries a counter of the active batches it belongs
+     * to, so registration is proportional to the batch's own size and takes
+     * no graph lock. Reset operations on these nodes will be prevented.
      *
-     * @param batchId Unique identifier for the batch operation
      * @param nodes Set of nodes affected by this batch
      */
-    void registerActiveBatch(const void *batchId, const NodeSet &nodes) {
-        ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
+    void registerActiveBatch(const NodeSet &nodes) noexcept {
         for (const auto &nodeWeak : nodes) {
             if (auto node = nodeWeak.lock()) {
-                m_activeBatchNodes[node].insert(batchId);
+                node->m_activeBatches.fetch_add(1, std::memory_order_acq_rel);
             }
         }
-        m_activeBatchIds.insert(batchId);
     }
 
     /**
      * @brief Unregister a batch operation.
      *
-     * Removes the batch from active tracking and allows reset operations
-     * on previously protected nodes.
+     * Releases the nodes registered by the batch and allows reset operations
+     * on them again. Nodes destroyed in the meantime are simply skipped.
      *
-     * @param batchId Unique identifier for the batch operation
+     * @param nodes The same set of nodes passed to registerActiveBatch
      */
-    void unregisterActiveBatch(const void *batchId) {
-        ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
-        m_activeBatchIds.erase(batchId);
-
-        // Remove this batch from all node tracking
-        for (auto it = m_activeBatchNodes.begin(); it != m_activeBatchNodes.end();) {
-            it->second.erase(batchId);
-            if (it->second.empty()) {
-                it = m_activeBatchNodes.erase(it);
-            } else {
-                ++it;
+    void unregisterActiveBatch(const NodeSet &nodes) noexcept {
+        for (const auto &nodeWeak : nodes) {
+            if (auto node = nodeWeak.lock()) {
+                node->m_activeBatches.fetch_sub(1, std::memory_order_acq_rel);
             }
         }
     }
@@ -141,10 +137,8 @@ public:
      * @param node The node to check
      * @return true if the node is in an active batch, false otherwise
      */
-    bool isNodeInActiveBatch(const NodePtr &node) const {
-        ConditionalSharedLock<ConditionalSharedMutex> lock(m_graphMutex);
-        auto it = m_activeBatchNodes.find(node);
-        return it != m_activeBatchNodes.end() && !it->second.empty();
+    bool isNodeInActiveBatch(const NodePtr &node) const noexcept {
+        return node->m_activeBatches.load(std::memory_order_acquire) > 0;
     }
 
     /**
@@ -155,6 +149,7 @@ public:
      * @throws std::runtime_error if the node is currently involved in an active batch operation
      */
     void resetNode(const NodePtr &node) {
+        TopologyRefresh refresh(*this);
         ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
         // Check if node exists in dependent list first
         if (m_dependentList.contains(node)) {
@@ -169,104 +164,121 @@ public:
             m_dependentList.at(node).clear();
         }
 
-        // Invalidate all caches due to graph structure change
-        m_graphCache.invalidateAll();
-        m_cycleCache.invalidateAll();
-        m_metricsCache.invalidateAll();
+        structureChanged();
     }
 
     /**
-     * @brief Transactional update of all observer dependencies.
+     * @brief Replace the dependencies of a node by diffing against the current ones.
      *
-     * This method ensures atomicity: either all observer updates succeed,
-     * or the original state is completely restored on failure.
+     * Edges that are kept are left untouched; only truly new edges are
+     * cycle-checked, and the caches are invalidated once, only if anything
+     * changed. Either the whole new list is committed or, if a new edge would
+     * create a cycle or a self-observation, the original edges are restored.
      *
-     * @tparam Args Parameter pack for node pointers.
-     * @param node The node whose observers are being updated.
-     * @param args New nodes to observe.
+     * @param node The node whose dependencies are being replaced.
+     * @param dependencies New dependencies; null entries and duplicates are ignored.
+     * @throws SelfObservationException or DependencyCycleException, leaving the graph unchanged.
      */
-    template <typename... Args>
-    void updateObserversTransactional(const NodePtr &node, Args &&...args) {
+    void rebindObservers(const NodePtr &node, const std::vector<NodePtr> &dependencies) {
         if (!node) return;
-
+        REACTION_REGISTER_THREAD();
+        TopologyRefresh refresh(*this);
+        AllocScope scope(AllocSubsystem::GRAPH);
         ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
 
-        // Step 1: Save current state for rollback
-        NodeSet originalDependents;
-        if (m_dependentList.contains(node)) {
-            originalDependents = m_dependentList[node];
+        if (!m_dependentList.contains(node)) {
+            addNodeInternal(node);
         }
-
-        // Step 2: Reset current dependencies
-        resetNodeInternal(node);
-
-        // Step 3: Try to add new observers
-        try {
-            // Add each observer using fold expression
-            ((args ? addObserverInternal(node, args) : void()), ...);
-
-        } catch (const std::exception &) {
-            // Step 4: Rollback - restore original dependencies
-            resetNodeInternal(node); // Clear any partially added observers
-
-            // Restore original dependencies
-            for (auto &dep : originalDependents) {
-                if (auto locked_dep = dep.lock()) {
-                    addObserverInternal(node, locked_dep);
-                }
+        NodeSet wanted;
+        std::vector<NodePtr> added;
+        for (const auto &dep : dependencies) {
+            if (dep && wanted.insert(dep).second && !m_dependentList.at(node).contains(dep)) {
+                added.push_back(dep);
             }
-
-            throw; // Re-throw the original exception
         }
-    }
-
-    /**
-     * @brief Transactional reset and update for a node's state.
-     *
-     * This method saves the current observer state, allows external operations,
-     * and provides rollback capability if needed.
-     *
-     * @param node The node to save state for.
-     * @return A rollback function that can restore the original state.
-     */
-    std::function<void()> saveNodeStateForRollback(const NodePtr &node) {
-        if (!node) return []() {};
-
-        ConditionalSharedLock<ConditionalSharedMutex> readLock(m_graphMutex);
-        // Save current state
-        NodeSet originalDependents;
-        if (m_dependentList.contains(node)) {
-            originalDependents = m_dependentList[node];
+        std::vector<NodeWeak> removed;
+        for (const auto &dep : m_dependentList.at(node)) {
+            if (!wanted.contains(dep)) {
+                removed.push_back(dep);
+            }
+        }
+        if (added.empty() && removed.empty()) {
+            return;
         }
-        // readLock will be automatically unlocked when it goes out of scope
 
-        // Return rollback function
-        return [this, node, originalDependents = std::move(originalDependents)]() mutable {
-            ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
-            // Reset current dependencies
-            resetNodeInternal(node);
+        for (const auto &dep : removed) {
+            unlinkInternal(node, dep);
+        }
+        if (!removed.empty()) {
+            // Cached cycle verdicts may no longer hold without the removed edges
+            m_cycleCache.invalidateAll();
+        }
 
-            // Restore original dependencies
-            for (auto &dep : originalDependents) {
+        size_t linked = 0;
+        REACTION_TRY {
+            for (; linked < added.size(); ++linked) {
+                addObserverInternal(node, added[linked]);
+            }
+        } REACTION_CATCH(const std::exception &) {
+            // Rollback - drop the new edges and restore the removed ones
+            for (size_t i = 0; i < linked; ++i) {
+                unlinkInternal(node, added[i]);
+            }
+            for (const auto &dep : removed) {
                 if (auto locked_dep = dep.lock()) {
-                    addObserverInternal(node, locked_dep);
+                    linkInternal(node, locked_dep);
                 }
             }
-        };
+            m_cycleCache.invalidateAll();
+            REACTION_RETHROW; // Re-throw the original exception
+        }
+
+        structureChanged();
     }
 
     /**
-     * @brief Recursively remove a node and its downstream dependents.
+     * @brief Remove a node and its downstream dependents.
      *
      * This is a cascade delete for the node and all nodes depending on it.
      * @param node Node to remove.
      */
     void closeNode(const NodePtr &node) {
-        if (!node) return;
+        closeMany(std::span<const NodePtr>(&node, 1));
+    }
 
-        ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
-        NodeSet closedNodes;
-        cascadeCloseDependents(node, closedNodes);
+    /**
+     * @brief Remove several nodes and all their downstream dependents at once.
+     *
+     * The affected subgraph is walked iteratively and only detached while the
+     * graph lock is held: closed nodes are unhooked from surviving dependencies
+     * and their map entries are extracted, which costs one pass over the closed
+     * edges. Releasing the extracted entries - and with them the nodes, their
+     * values and captured functions - happens after the lock is dropped, so
+     * tearing down a large subgraph does not stall other threads, and node
+     * destructors may safely use the graph again.
+     *
+     * @param nodes Roots to close; null entries are ignored.
+     */
+    void closeMany(std::span<const NodePtr> nodes) {
+        // Runs last, once the detached nodes are gone
+        TopologyRefresh refresh(*this);
+        std::vector<DetachedNode> detached;
+        {
+            REACTION_REGISTER_THREAD();
+            ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
+            NodeSet closedNodes;
+            std::vector<NodePtr> closedOrder;
+            collectClosure(nodes, closedNodes, closedOrder);
+            if (closedOrder.empty()) return;
+
+            detached.reserve(closedOrder.size());
+            for (const auto &node : closedOrder) {
+                detachInternal(node, closedNodes, detached);
+            }
+
+            structureChanged();
+        }
+        // Physical reclamation of the detached nodes happens here, unlocked
     }
 
     void collectObservers(const NodePtr &node, NodeSet &observers, uint16_t depth) noexcept;
@@ -274,13 +286,16 @@ public:
     /**
      * @brief Set a human-readable name for a node.
      *
-     * Names are used for logging and debugging.
+     * Names are used for logging and debugging. They are interned in the
+     * NameTable and stored on the node, so the graph lock is not taken.
+     * A no-op when names are compiled out.
      * @param node Node to name.
      * @param name Assigned name.
      */
-    void setName(const NodePtr &node, const std::string &name) noexcept {
-        ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
-        m_nameList.insert({node, name});
+    void setName(const NodePtr &node, [[maybe_unused]] std::string_view name) {
+#if REACTION_ENABLE_NAMES
+        node->m_name.store(NameTable::getInstance().intern(name), std::memory_order_release);
+#endif
     }
 
     /**
@@ -289,10 +304,164 @@ public:
      * @return Human-readable name or empty string if not found.
      */
     [[nodiscard]] std::string getName(const NodePtr &node) noexcept {
-        ConditionalSharedLock<ConditionalSharedMutex> lock(m_graphMutex);
         return getNameInternal(node);
     }
 
+    /**
+     * @brief Visit every node registered in the graph.
+     * @param f Callable invoked with each node pointer.
+     */
+    template <typename F>
+    void forEachNode(F &&f) {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_graphMutex);
+        for (auto &[node, observers] : m_observerList) {
+            std::invoke(f, node);
+        }
+    }
+
+    /**
+     * @brief Visit every node that has a name assigned.
+     * @param f Callable invoked with each node pointer and its name (as std::string_view).
+     */
+    template <typename F>
+    void forEachNamedNode(F &&f) {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_graphMutex);
+        for (auto &[node, observers] : m_observerList) {
+            if (NameHandle handle = node->getNameHandle(); handle != NO_NAME) {
+                std::invoke(f, node, NameTable::getInstance().view(handle));
+            }
+        }
+    }
+
+    /**
+     * @brief Build a compact topology snapshot for propagation.
+     *
+     * Numbers all nodes in topological order and lays their observer lists
+     * out contiguously (see CompactTopology). Until the graph structure next
+     * changes, notifications walk the snapshot instead of the per-node
+     * observer sets. Call again after the graph has been (re)built, or turn
+     * on setAutoCompact() to have every structural edit publish a new one.
+     *
+     * Propagations read the snapshot under an EpochGuard without taking any
+     * lock; a replaced snapshot is released once they have all moved on.
+     *
+     * @return size_t Number of nodes in the snapshot.
+     */
+    size_t compact() {
+        auto topology = std::make_shared<CompactTopology>();
+        {
+            ConditionalSharedLock<ConditionalSharedMutex> lock(m_graphMutex);
+            buildTopology(*topology);
+        }
+        const size_t size = topology->nodes.size();
+        std::shared_ptr<const CompactTopology> previous;
+        {
+            ConditionalUniqueLock<ConditionalSharedMutex> lock(m_topologyMutex);
+            // A structure change raced with the build; the snapshot is already stale
+            if (topology->version != m_structureVersion.load(std::memory_order_acquire)) return 0;
+            previous = std::move(m_topology);
+            m_topology = std::move(topology);
+            m_current.store(m_topology.get(), std::memory_order_seq_cst);
+            m_hasTopology.store(true, std::memory_order_release);
+        }
+        auto &epochs = EpochManager::getInstance();
+        epochs.retire(std::move(previous));
+        epochs.reclaim();
+        return size;
+    }
+
+    /**
+     * @brief Republish the compact topology after every structural edit.
+     *
+     * The editing thread rebuilds the snapshot once it has released the graph
+     * lock, so subscriptions and resets never leave propagation on the
+     * per-node observer sets for long. Each rebuild costs a pass over the
+     * whole graph; enable this once the bulk of the graph exists.
+     *
+     * @param enabled Whether to republish; enabling compacts immediately.
+     */
+    void setAutoCompact(bool enabled) {
+        m_autoCompact.store(enabled, std::memory_order_relaxed);
+        if (enabled) {
+            compact();
+        }
+    }
+
+    /// @brief Whether structural edits republish the compact topology.
+    [[nodiscard]] bool isAutoCompact() const noexcept {
+        return m_autoCompact.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Whether a current compact topology is published.
+    [[nodiscard]] bool hasCompactTopology() const noexcept {
+        return m_hasTopology.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the current compact topology without locking or pinning it.
+     *
+     * The caller must hold an EpochGuard for as long as it uses the result.
+     * @return The snapshot, or nullptr if none is current.
+     */
+    [[nodiscard]] const CompactTopology *currentTopology() const noexcept {
+        const CompactTopology *topology = m_current.load(std::memory_order_seq_cst);
+        if (topology && topology->version != structureVersion()) return nullptr;
+        return topology;
+    }
+
+    /**
+     * @brief Get the current compact topology.
+     * @return The snapshot, or nullptr if none is current.
+     */
+    [[nodiscard]] std::shared_ptr<const CompactTopology> compactTopology() const {
+        if (!m_hasTopology.load(std::memory_order_acquire)) return nullptr;
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_topologyMutex);
+        return m_topology;
+    }
+
+    /// @brief Version of the graph structure, bumped by every edge or node removal change.
+    [[nodiscard]] uint64_t structureVersion() const noexcept {
+        return m_structureVersion.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Allocate the graph's internal containers from a memory resource.
+     *
+     * Covers the observer and dependency maps, the observer set of every node
+     * created afterwards and the cache entries. Pooled or monotonic resources
+     * replace one global heap allocation per hash node with cheap bump or
+     * free-list allocations. The resource must be thread-safe if the graph is
+     * used from several threads, and must outlive the graph.
+     *
+     * @param resource Resource to allocate from.
+     * @throws InvalidStateException if the graph still holds nodes.
+     */
+    void useMemoryResource(std::pmr::memory_resource *resource) {
+        if (!resource) {
+            REACTION_THROW_NULL_POINTER("memory resource");
+        }
+        rebindMemory(resource, nullptr);
+    }
+
+    /**
+     * @brief Allocate the graph's internal containers from a pool owned by the graph.
+     *
+     * Installs a synchronized pool resource drawing from the global heap.
+     * The previous graph-owned pool, if any, is released.
+     * @param options Pool tuning.
+     * @throws InvalidStateException if the graph still holds nodes.
+     */
+    void usePooledMemory(const std::pmr::pool_options &options = {}) {
+        auto pool = std::make_unique<std::pmr::synchronized_pool_resource>(options);
+        auto *resource = pool.get();
+        rebindMemory(resource, std::move(pool));
+    }
+
+    /// @brief Resource the graph's containers currently allocate from.
+    [[nodiscard]] std::pmr::memory_resource *memoryResource() const noexcept {
+        return GraphMemory::getInstance().resource();
+    }
+
     /**
      * @brief Trigger cleanup of all cache subsystems.
      *
@@ -327,22 +496,47 @@ public:
     }
 
 private:
-    ObserverGraph() {}
+    /// @brief Map from node to its observers (refs).
+    using ObserverMap = std::pmr::unordered_map<NodePtr, NodeSetRef>;
+    /// @brief Map from node to its dependencies.
+    using DependencyMap = std::pmr::unordered_map<NodePtr, NodeSet>;
+
+    ObserverGraph()
+        : m_observerList(GraphMemory::getInstance().resource()), m_dependentList(GraphMemory::getInstance().resource()) {
+        m_graphCache.useMemoryResource(memoryResource());
+        m_cycleCache.useMemoryResource(memoryResource());
+        m_metricsCache.useMemoryResource(memoryResource());
+    }
 
-    mutable ConditionalSharedMutex m_graphMutex; ///< Conditional mutex for thread-safe graph operations.
+    mutable ConditionalSharedMutex m_graphMutex{LockClass::GRAPH}; ///< Conditional mutex for thread-safe graph operations.
 
     /**
-     * @brief Internal get name operation without locking.
-     * Should only be called when the graph mutex is already held.
+     * @brief Move the empty graph onto a resource.
+     * @param resource New resource.
+     * @param pool Owner of resource, if the graph owns it.
+     */
+    void rebindMemory(std::pmr::memory_resource *resource, std::unique_ptr<std::pmr::memory_resource> pool) {
+        ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
+        if (!m_dependentList.empty()) {
+            REACTION_THROW_INVALID_STATE(std::to_string(m_dependentList.size()) + " nodes alive", "empty graph");
+        }
+        std::destroy_at(&m_observerList);
+        std::construct_at(&m_observerList, resource);
+        std::destroy_at(&m_dependentList);
+        std::construct_at(&m_dependentList, resource);
+        m_graphCache.useMemoryResource(resource);
+        m_cycleCache.useMemoryResource(resource);
+        m_metricsCache.useMemoryResource(resource);
+        GraphMemory::getInstance().set(resource, std::move(pool));
+    }
+
+    /**
+     * @brief Get name operation; safe with or without the graph mutex held.
      * @param node Node to query.
      * @return Human-readable name or empty string if not found.
      */
     [[nodiscard]] std::string getNameInternal(const NodePtr &node) noexcept {
-        if (m_nameList.contains(node)) {
-            return m_nameList[node];
-        } else {
-            return "";
-        }
+        return std::string(NameTable::getInstance().view(node->getNameHandle()));
     }
 
     /**
@@ -353,62 +547,173 @@ private:
     void addNodeInternal(const NodePtr &node) noexcept;
 
     /**
-     * @brief Helper function to recursively close dependents of a node.
-     * @param node Starting node.
-     * @param closedNodes Set of already closed nodes to avoid cycles.
+     * @brief Record a change of the graph structure.
+     *
+     * Invalidates all caches and retires the compact topology.
+     * Should only be called when graph mutex is already held.
+     * @return The retired topology, so the caller may release it after unlocking.
      */
-    void cascadeCloseDependents(const NodePtr &node, NodeSet &closedNodes) {
-        if (!node || closedNodes.contains(node)) return;
-        closedNodes.insert(node);
-
-        // Check if node exists in observer list to avoid at() exceptions
-        if (m_observerList.contains(node)) {
-            auto observerLists = m_observerList.at(node).get();
+    void structureChanged() {
+        m_graphCache.invalidateAll();
+        m_cycleCache.invalidateAll();
+        m_metricsCache.invalidateAll();
 
-            for (auto &ob : observerLists) {
-                cascadeCloseDependents(ob.lock(), closedNodes);
-            }
+        m_structureVersion.fetch_add(1, std::memory_order_acq_rel);
+        if (!m_hasTopology.load(std::memory_order_acquire)) return;
+        std::shared_ptr<const CompactTopology> retired;
+        {
+            ConditionalUniqueLock<ConditionalSharedMutex> lock(m_topologyMutex);
+            m_hasTopology.store(false, std::memory_order_release);
+            m_current.store(nullptr, std::memory_order_seq_cst);
+            retired = std::move(m_topology);
         }
-
-        closeNodeInternal(node);
+        // Propagations may still be walking it; freed by a later reclaim()
+        EpochManager::getInstance().retire(std::move(retired));
     }
 
     /**
-     * @brief Internal close operation for a node.
+     * @brief Republishes the compact topology once a structural edit is done.
      *
-     * Removes node from all internal data structures.
-     * @param node Node to close.
+     * Declared before the graph lock in every editing method, so it runs
+     * after the lock has been released.
      */
-    void closeNodeInternal(const NodePtr &node) {
-        if (!node) return;
+    class TopologyRefresh {
+    public:
+        explicit TopologyRefresh(ObserverGraph &graph) noexcept : m_graph(graph) {}
+
+        ~TopologyRefresh() {
+            REACTION_TRY {
+                if (m_graph.isAutoCompact() && !m_graph.hasCompactTopology()) {
+                    m_graph.compact();
+                } else if (EpochManager::getInstance().retiredCount() > 0) {
+                    EpochManager::getInstance().reclaim();
+                }
+            } REACTION_CATCH(...) {
+                // Propagation stays on the per-node observer sets until the next edit
+            }
+        }
 
-        // Clean up dependent relationships - this node observes others
-        if (m_dependentList.contains(node)) {
-            for (auto dep : m_dependentList[node]) {
-                if (auto locked_dep = dep.lock()) {
-                    if (m_observerList.contains(locked_dep)) {
-                        ConditionalUniqueLock<ConditionalSharedMutex> observerLock(locked_dep->m_observersMutex);
-                        m_observerList.at(locked_dep).get().erase(node);
+        TopologyRefresh(const TopologyRefresh &) = delete;
+        TopologyRefresh &operator=(const TopologyRefresh &) = delete;
+
+    private:
+        ObserverGraph &m_graph;
+    };
+
+    /**
+     * @brief Fill a topology snapshot from the current graph.
+     * Should only be called when graph mutex is already held.
+     */
+    void buildTopology(CompactTopology &topology) {
+        topology.version = m_structureVersion.load(std::memory_order_acquire);
+        topology.nodes.reserve(m_dependentList.size());
+
+        // Kahn's algorithm: a node is placed once all its dependencies are
+        std::unordered_map<const ObserverNode *, size_t> pending;
+        for (const auto &[node, deps] : m_dependentList) {
+            size_t live = 0;
+            for (const auto &dep : deps) {
+                if (!dep.expired()) ++live;
+            }
+            if (live == 0) {
+                topology.nodes.push_back(node);
+            } else {
+                pending.emplace(node.get(), live);
+            }
+        }
+        // Roots in creation order keep the layout stable between builds
+        std::sort(topology.nodes.begin(), topology.nodes.end(), [](const NodePtr &a, const NodePtr &b) {
+            return a->getId() < b->getId();
+        });
+        for (size_t next = 0; next < topology.nodes.size(); ++next) {
+            const NodePtr node = topology.nodes[next];
+            node->m_denseIndex.store(static_cast<uint32_t>(next), std::memory_order_relaxed);
+            for (const auto &ob : node->m_observers) {
+                if (auto locked_ob = ob.lock()) {
+                    if (auto it = pending.find(locked_ob.get()); it != pending.end() && --it->second == 0) {
+                        topology.nodes.push_back(std::move(locked_ob));
                     }
                 }
             }
-            m_dependentList.erase(node);
         }
 
-        // Clean up observer relationships - others observe this node
-        if (m_observerList.contains(node)) {
-            for (auto &ob : m_observerList.at(node).get()) {
+        topology.offsets.reserve(topology.nodes.size() + 1);
+        topology.offsets.push_back(0);
+        for (const auto &node : topology.nodes) {
+            const size_t first = topology.observers.size();
+            for (const auto &ob : node->m_observers) {
                 if (auto locked_ob = ob.lock()) {
-                    if (m_dependentList.contains(locked_ob)) {
-                        m_dependentList.at(locked_ob).erase(node);
+                    const uint32_t index = locked_ob->m_denseIndex.load(std::memory_order_relaxed);
+                    if (topology.contains(locked_ob.get(), index)) {
+                        topology.observers.push_back(index);
                     }
                 }
             }
-            m_observerList.erase(node);
+            std::sort(topology.observers.begin() + static_cast<std::ptrdiff_t>(first), topology.observers.end());
+            topology.offsets.push_back(static_cast<uint32_t>(topology.observers.size()));
         }
+    }
 
-        // Remove name mapping
-        m_nameList.erase(node);
+    /**
+     * @brief Map entries of a detached node, released once the graph lock is dropped.
+     */
+    struct DetachedNode {
+        ObserverMap::node_type observers;   ///< Entry of m_observerList.
+        DependencyMap::node_type dependents; ///< Entry of m_dependentList.
+    };
+
+    /**
+     * @brief Collect the given nodes and everything downstream of them.
+     * Should only be called when graph mutex is already held.
+     * @param roots Starting nodes.
+     * @param closedNodes Receives every node to close.
+     * @param closedOrder Receives the same nodes in discovery order.
+     */
+    void collectClosure(std::span<const NodePtr> roots, NodeSet &closedNodes, std::vector<NodePtr> &closedOrder) {
+        std::vector<NodePtr> pending;
+        for (const auto &root : roots) {
+            if (root) pending.push_back(root);
+        }
+        while (!pending.empty()) {
+            NodePtr node = std::move(pending.back());
+            pending.pop_back();
+            if (!closedNodes.insert(node).second) continue;
+            closedOrder.push_back(node);
+
+            if (auto it = m_observerList.find(node); it != m_observerList.end()) {
+                for (auto &ob : it->second.get()) {
+                    if (auto locked_ob = ob.lock()) {
+                        pending.push_back(std::move(locked_ob));
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Unhook a closing node and extract its map entries.
+     *
+     * Only edges towards dependencies that stay open need unlinking; edges
+     * among closing nodes disappear with the extracted entries.
+     * Should only be called when graph mutex is already held.
+     * @param node Node to close.
+     * @param closedNodes All nodes closed by the same operation.
+     * @param detached Receives the extracted entries.
+     */
+    void detachInternal(const NodePtr &node, const NodeSet &closedNodes, std::vector<DetachedNode> &detached) {
+        auto dependents = m_dependentList.extract(node);
+        if (!dependents.empty()) {
+            for (const auto &dep : dependents.mapped()) {
+                if (closedNodes.contains(dep)) continue;
+                if (auto locked_dep = dep.lock()) {
+                    if (m_observerList.contains(locked_dep)) {
+                        ConditionalUniqueLock<ConditionalSharedMutex> observerLock(locked_dep->m_observersMutex);
+                        m_observerList.at(locked_dep).get().erase(node);
+                    }
+                }
+            }
+        }
+        detached.push_back({m_observerList.extract(node), std::move(dependents)});
     }
 
     /**
@@ -528,18 +833,43 @@ private:
             REACTION_THROW_DEPENDENCY_CYCLE(getNameInternal(source), getNameInternal(target));
         }
 
+        linkInternal(source, target);
+    }
+
+    /**
+     * @brief Insert an edge (source observes target) without any checks.
+     * Should only be called when graph mutex is already held.
+     */
+    void linkInternal(const NodePtr &source, const NodePtr &target) {
         m_dependentList.at(source).insert(target);
-        {
-            ConditionalUniqueLock<ConditionalSharedMutex> targetLock(target->m_observersMutex);
-            target->m_observers.insert(source);
+        ConditionalUniqueLock<ConditionalSharedMutex> targetLock(target->m_observersMutex);
+        target->m_observers.insert(source);
+    }
+
+    /**
+     * @brief Remove an edge (source observes target).
+     * Should only be called when graph mutex is already held.
+     */
+    void unlinkInternal(const NodePtr &source, const NodeWeak &target) {
+        m_dependentList.at(source).erase(target);
+        if (auto locked_target = target.lock()) {
+            if (m_observerList.contains(locked_target)) {
+                ConditionalUniqueLock<ConditionalSharedMutex> observerLock(locked_target->m_observersMutex);
+                m_observerList.at(locked_target).get().erase(source);
+            }
         }
     }
 
-    std::unordered_map<NodePtr, NodeSetRef> m_observerList;                 ///< Map from node to its observers (refs).
-    std::unordered_map<NodePtr, NodeSet> m_dependentList;                   ///< Map from node to its dependencies.
-    std::unordered_map<NodePtr, std::string> m_nameList;                    ///< Human-readable node names.
-    std::unordered_map<NodePtr, std::set<const void *>> m_activeBatchNodes; ///< Map from node to active batch IDs.
-    std::set<const void *> m_activeBatchIds;                                ///< Set of all active batch IDs.
+    ObserverMap m_observerList;   ///< Map from node to its observers (refs).
+    DependencyMap m_dependentList; ///< Map from node to its dependencies.
+
+    // Compact topology
+    std::atomic<uint64_t> m_structureVersion{0};          ///< Bumped by every structure change.
+    std::atomic<bool> m_hasTopology{false};               ///< Whether m_topology is current.
+    std::atomic<bool> m_autoCompact{false};               ///< Whether edits republish the snapshot.
+    mutable ConditionalSharedMutex m_topologyMutex{LockClass::GRAPH}; ///< Protects m_topology.
+    std::shared_ptr<const CompactTopology> m_topology;    ///< Current snapshot, if any.
+    std::atomic<const CompactTopology *> m_current{nullptr}; ///< m_topology for epoch-pinned readers.
 
     // Cache subsystems
     mutable GraphTraversalCache m_graphCache; ///< Cache for graph traversal results.
@@ -555,6 +885,7 @@ private:
  */
 inline void ObserverGraph::addNode(const NodePtr &node) noexcept {
     REACTION_REGISTER_THREAD();
+    AllocScope scope(AllocSubsystem::GRAPH);
     ConditionalUniqueLock<ConditionalSharedMutex> lock(m_graphMutex);
     m_observerList.insert({node, std::ref(node->m_observers)});
     m_dependentList[node] = NodeSet{};
@@ -579,6 +910,7 @@ inline void ObserverGraph::addNodeInternal(const NodePtr &node) noexcept {
  */
 inline void ObserverGraph::collectObservers(const NodePtr &node, NodeSet &observers, uint16_t depth = 1) noexcept {
     if (!node) return;
+    AllocScope scope(AllocSubsystem::GRAPH);
 
     NodeSet currentObservers;
     {
@@ -619,4 +951,49 @@ inline void ObserverGraph::collectObservers(const NodePtr &node, NodeSet &observ
     }
 }
 
+/**
+ * @brief Implementation of ObserverNode::ensureOutsideBatch.
+ */
+inline void ObserverNode::ensureOutsideBatch() {
+    if (ObserverGraph::getInstance().isNodeInActiveBatch(shared_from_this())) {
+        REACTION_THROW_BATCH_CONFLICT("Reset operations must be performed outside of batch contexts");
+    }
+}
+
+/**
+ * @brief Implementation of ObserverNode::rebindSources.
+ */
+inline void ObserverNode::rebindSources(const std::vector<NodePtr> &dependencies) {
+    ObserverGraph::getInstance().rebindObservers(shared_from_this(), dependencies);
+}
+
+/**
+ * @brief Implementation of ObserverNode::notifyCompact.
+ *
+ * The outermost notification of a propagation pins the current epoch and
+ * loads the snapshot without locking; nested notifications reuse it as long
+ * as the structure version still matches.
+ */
+inline bool ObserverNode::notifyCompact(bool changed) {
+    auto &graph = ObserverGraph::getInstance();
+    const CompactTopology *topology = g_compact_topology;
+    if (!topology && !graph.hasCompactTopology()) return false;
+
+    // Only the outermost pin publishes an epoch; it covers snapshots loaded by nested notifications too
+    EpochGuard epoch;
+    if (!topology || topology->version != graph.structureVersion()) {
+        topology = graph.currentTopology();
+        if (!topology) return false;
+    }
+
+    const uint32_t index = m_denseIndex.load(std::memory_order_relaxed);
+    if (!topology->contains(this, index)) return false;
+
+    CompactTopologyGuard guard(topology);
+    for (uint32_t observer : topology->observersOf(index)) {
+        topology->nodes[observer]->valueChanged(changed);
+    }
+    return true;
+}
+
 } // namespace reaction
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/concurrency/global_state.h"
+#include "reaction/concurrency/thread_manager.h"
+#include "reaction/core/observer_node.h"
+#include "reaction/core/types.h"
+#include "reaction/graph/observer_graph.h"
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Work limit for a single propagation slice.
+ *
+ * A value of zero disables the corresponding limit. When both limits are zero
+ * every slice runs until no parked work is left.
+ */
+struct SliceBudget {
+    size_t maxNodes = 0;                 ///< Maximum number of nodes evaluated per slice.
+    std::chrono::nanoseconds maxTime{0}; ///< Maximum wall time spent per slice.
+};
+
+/**
+ * @brief Time-sliced propagation scheduler.
+ *
+ * While enabled, a value change no longer recurses through the observer chain.
+ * Instead the whole downstream cone of the changed node is marked stale and
+ * parked in depth order, and at most one budget worth of nodes is evaluated
+ * before the writer returns. The remaining nodes are resumed by later calls
+ * to runSlice(), typically once per event loop iteration.
+ *
+ * The graph stays consistent while work is parked:
+ * - nodes are evaluated in depth order, so a node never sees a stale input;
+ * - reading a stale node pulls the parked work up to that node first.
+ *
+ * Like batch execution, every node in a parked cone is recomputed once
+ * regardless of whether its direct inputs actually changed.
+ */
+class PropagationScheduler {
+public:
+    /**
+     * @brief Get the singleton instance of the scheduler.
+     * @return PropagationScheduler& singleton reference.
+     */
+    [[nodiscard]] static PropagationScheduler &getInstance() noexcept {
+        static PropagationScheduler instance;
+        return instance;
+    }
+
+    /**
+     * @brief Enable sliced propagation with the given budget.
+     * @param budget Work limit applied to every slice.
+     */
+    void enable(SliceBudget budget) noexcept {
+        {
+            ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+            m_budget = budget;
+        }
+        g_sliced_propagation.store(true, std::memory_order_release);
+    }
+
+    /**
+     * @brief Disable sliced propagation.
+     *
+     * All parked work is drained first so that no node is left stale.
+     */
+    void disable() {
+        g_sliced_propagation.store(false, std::memory_order_release);
+        drain();
+    }
+
+    /// @brief Whether value changes are currently routed through the scheduler.
+    [[nodiscard]] bool isEnabled() const noexcept {
+        return g_sliced_propagation.load(std::memory_order_acquire);
+    }
+
+    /// @brief Whether any node is still waiting to be evaluated.
+    [[nodiscard]] bool hasPending() const noexcept {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        return m_pendingCount > 0;
+    }
+
+    /// @brief Number of nodes still waiting to be evaluated.
+    [[nodiscard]] size_t pendingCount() const noexcept {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        return m_pendingCount;
+    }
+
+    /**
+     * @brief Park the downstream cone of a changed node and run one slice.
+     * @param source Node whose value changed.
+     */
+    void schedule(const NodePtr &source) {
+        NodeSet cone;
+        ObserverGraph::getInstance().collectObservers(source, cone);
+        {
+            ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+            for (auto &weak : cone) {
+                if (auto node = weak.lock()) [[likely]] {
+                    // Already parked nodes keep their slot, the stale flag deduplicates
+                    if (!node->m_stale.exchange(true, std::memory_order_acq_rel)) {
+                        m_pending[node->m_depth.load(std::memory_order_relaxed)].push_back(weak);
+                        ++m_pendingCount;
+                    }
+                }
+            }
+        }
+        runSlice();
+    }
+
+    /**
+     * @brief Resume parked work within the configured budget.
+     * @return size_t Number of nodes evaluated.
+     */
+    size_t runSlice() {
+        SliceBudget budget;
+        {
+            ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+            budget = m_budget;
+        }
+        return run(budget);
+    }
+
+    /**
+     * @brief Evaluate all parked work regardless of the budget.
+     * @return size_t Number of nodes evaluated.
+     */
+    size_t drain() {
+        return run(SliceBudget{});
+    }
+
+    /**
+     * @brief Evaluate parked work until the given node is up to date.
+     *
+     * Called when a stale node is read. Everything parked at a lower depth is
+     * evaluated first, so the pulled value is consistent with its inputs.
+     *
+     * @param target Node being read.
+     */
+    void pull(const ObserverNode *target) {
+        // Inputs of a node being evaluated were already processed in depth order
+        if (t_running) return;
+        RunningGuard guard;
+        while (target->m_stale.load(std::memory_order_acquire) && evaluateNext()) {
+        }
+    }
+
+private:
+    PropagationScheduler() = default;
+
+    /**
+     * @brief RAII marker for the thread currently evaluating parked work.
+     */
+    struct RunningGuard {
+        RunningGuard() noexcept { t_running = true; }
+        ~RunningGuard() noexcept { t_running = false; }
+    };
+
+    /**
+     * @brief Evaluate parked work within a budget.
+     * @param budget Work limit for this run.
+     * @return size_t Number of nodes evaluated.
+     */
+    size_t run(const SliceBudget &budget) {
+        if (t_running) return 0;
+        RunningGuard guard;
+
+        const bool timed = budget.maxTime.count() > 0;
+        const auto deadline = timed ? std::chrono::steady_clock::now() + budget.maxTime
+                                    : std::chrono::steady_clock::time_point::max();
+        size_t processed = 0;
+        while (budget.maxNodes == 0 || processed < budget.maxNodes) {
+            if (!evaluateNext()) break;
+            ++processed;
+            if (timed && std::chrono::steady_clock::now() >= deadline) break;
+        }
+        return processed;
+    }
+
+    /**
+     * @brief Pop the shallowest parked node and evaluate it.
+     * @return false if nothing was parked.
+     */
+    bool evaluateNext() {
+        NodePtr node;
+        {
+            ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+            while (!node && !m_pending.empty()) {
+                auto level = m_pending.begin();
+                auto weak = std::move(level->second.back());
+                level->second.pop_back();
+                if (level->second.empty()) {
+                    m_pending.erase(level);
+                }
+                --m_pendingCount;
+                node = weak.lock();
+            }
+        }
+        if (!node) return false;
+
+        // Clear first so that a write racing with this evaluation parks the node again
+        node->m_stale.store(false, std::memory_order_release);
+        node->changedNoNotify(true);
+        return true;
+    }
+
+    static inline thread_local bool t_running = false; ///< Whether this thread is evaluating parked work.
+
+    mutable ConditionalMutex m_mutex;                        ///< Protects the parked work and budget.
+    SliceBudget m_budget;                                    ///< Budget applied by runSlice().
+    std::map<uint16_t, std::vector<NodeWeak>> m_pending;     ///< Parked nodes bucketed by depth.
+    size_t m_pendingCount{0};                                ///< Total number of parked nodes.
+};
+
+/**
+ * @brief Implementation of ObserverNode::parkObservers.
+ *
+ * Hands the downstream cone of this node to the propagation scheduler.
+ */
+inline void ObserverNode::parkObservers() {
+    PropagationScheduler::getInstance().schedule(shared_from_this());
+}
+
+/**
+ * @brief Implementation of ObserverNode::pullIfStale.
+ *
+ * Resumes parked work until this node is up to date.
+ */
+inline void ObserverNode::pullIfStale() const {
+    if (m_stale.load(std::memory_order_acquire)) [[unlikely]] {
+        PropagationScheduler::getInstance().pull(this);
+    }
+}
+
+} // namespace reaction
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/factory/reactive_factory.h"
+#include "reaction/graph/change_feed.h"
+#include "reaction/ipc/shared_memory.h"
+#include "reaction/ipc/transport.h"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Identifier linking a remote output to the remote input it feeds.
+ */
+using ChannelId = uint32_t;
+
+/**
+ * @brief Wire format of remote delta frames.
+ *
+ * A frame carries every value that changed in one propagation epoch of the
+ * sending graph: a header followed by one entry per changed channel, each
+ * padded to 8 bytes. Integers use the host byte order, as both ends run on
+ * the same machine.
+ */
+namespace remote {
+
+struct FrameHeader {
+    uint64_t epoch;   ///< Epoch of the sending graph.
+    uint32_t count;   ///< Number of entries.
+    uint32_t reserved;
+};
+
+struct EntryHeader {
+    ChannelId channel;
+    uint32_t size;    ///< Value bytes following the header.
+};
+
+/// @brief Bytes an entry occupies in a frame.
+constexpr size_t entrySize(size_t valueSize) noexcept {
+    return sizeof(EntryHeader) + (valueSize + 7) / 8 * 8;
+}
+
+} // namespace remote
+
+/**
+ * @brief Ships node values to another graph partition.
+ *
+ * Each published node acts as a "remote output": an action stages its value
+ * whenever it changes. Staged values are coalesced per channel, so a node
+ * that changes several times before shipping costs one entry, and all
+ * values of one propagation epoch travel in a single frame. A frame is sent
+ * when a change from a newer epoch arrives or when flush() is called, which
+ * the owner typically does once per tick or batch.
+ */
+class RemoteOutput {
+public:
+    /**
+     * @brief Create an output over a transport.
+     * @param transport Connected transport; must outlive the output.
+     */
+    explicit RemoteOutput(Transport &transport) : m_transport(transport) {}
+
+    ~RemoteOutput() {
+        for (auto &closer : m_closers) {
+            closer();
+        }
+    }
+
+    RemoteOutput(const RemoteOutput &) = delete;
+    RemoteOutput &operator=(const RemoteOutput &) = delete;
+
+    /**
+     * @brief Publish a node on a channel.
+     *
+     * @param channel Channel id the receiving side binds to.
+     * @param source Var or calc whose value is shipped.
+     * @return RemoteOutput& This output, for chaining.
+     * @throws InvalidStateException if the channel is already published.
+     */
+    template <IsReact R>
+        requires SharedValue<std::remove_cvref_t<typename std::remove_cvref_t<R>::value_type>>
+    RemoteOutput &publish(ChannelId channel, const R &source) {
+        using T = std::remove_cvref_t<typename std::remove_cvref_t<R>::value_type>;
+        size_t index;
+        {
+            ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+            if (m_channelIndex.contains(channel)) {
+                REACTION_THROW_INVALID_STATE("channel " + std::to_string(channel) + " already published", "unique channel");
+            }
+            index = m_channels.size();
+            m_channelIndex.emplace(channel, index);
+            m_channels.push_back({channel, std::vector<std::byte>(sizeof(T)), false});
+        }
+        auto mirror = reaction::action([this, index](const T &value) {
+            stage(index, &value);
+        }, source);
+        m_closers.push_back([mirror]() mutable {
+            if (mirror) mirror.close();
+        });
+        return *this;
+    }
+
+    /**
+     * @brief Send all staged values as one frame.
+     * @return bool Whether a frame was sent.
+     */
+    bool flush() {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        return flushLocked();
+    }
+
+    /// @brief Number of frames sent so far.
+    [[nodiscard]] size_t framesSent() const noexcept {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        return m_framesSent;
+    }
+
+private:
+    /**
+     * @brief Pending value of one channel.
+     */
+    struct Channel {
+        ChannelId id;                 ///< Channel id.
+        std::vector<std::byte> value; ///< Latest staged value.
+        bool dirty;                   ///< Whether the value awaits shipping.
+    };
+
+    void stage(size_t index, const void *value) {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_mutex);
+        const uint64_t epoch = ChangeFeed::getInstance().now();
+        if (!m_dirty.empty() && epoch != m_pendingEpoch) {
+            flushLocked();
+        }
+        m_pendingEpoch = epoch;
+
+        Channel &channel = m_channels[index];
+        std::memcpy(channel.value.data(), value, channel.value.size());
+        if (!channel.dirty) {
+            channel.dirty = true;
+            m_dirty.push_back(index);
+        }
+    }
+
+    bool flushLocked() {
+        if (m_dirty.empty()) return false;
+
+        size_t size = sizeof(remote::FrameHeader);
+        for (size_t index : m_dirty) {
+            size += remote::entrySize(m_channels[index].value.size());
+        }
+        m_frame.assign(size, std::byte{});
+
+        remote::FrameHeader header{m_pendingEpoch, static_cast<uint32_t>(m_dirty.size()), 0};
+        std::memcpy(m_frame.data(), &header, sizeof(header));
+        size_t offset = sizeof(header);
+        for (size_t index : m_dirty) {
+            Channel &channel = m_channels[index];
+            remote::EntryHeader entry{channel.id, static_cast<uint32_t>(channel.value.size())};
+            std::memcpy(m_frame.data() + offset, &entry, sizeof(entry));
+            std::memcpy(m_frame.data() + offset + sizeof(entry), channel.value.data(), channel.value.size());
+            offset += remote::entrySize(channel.value.size());
+            channel.dirty = false;
+        }
+        m_dirty.clear();
+
+        m_transport.send(m_frame);
+        ++m_framesSent;
+        return true;
+    }
+
+    Transport &m_transport;                                ///< Outgoing transport.
+    mutable ConditionalMutex m_mutex;                      ///< Protects staging and sending.
+    std::vector<Channel> m_channels;                       ///< Published channels.
+    std::unordered_map<ChannelId, size_t> m_channelIndex;  ///< Channel id to index.
+    std::vector<size_t> m_dirty;                           ///< Channels staged since the last frame.
+    uint64_t m_pendingEpoch{0};                            ///< Epoch of the staged values.
+    std::vector<std::byte> m_frame;                        ///< Reused frame buffer.
+    size_t m_framesSent{0};                                ///< Frames sent so far.
+    std::vector<std::function<void()>> m_closers;          ///< Close the staging actions.
+};
+
+/**
+ * @brief Feeds source Vars from another graph partition.
+ *
+ * Each bound Var acts as a "remote input". poll() drains the transport and
+ * applies every received frame as one batch, so downstream nodes see the
+ * values of one remote epoch together and recompute once per frame.
+ */
+class RemoteInput {
+public:
+    /**
+     * @brief Create an input over a transport.
+     * @param transport Connected transport; must outlive the input.
+     */
+    explicit RemoteInput(Transport &transport) : m_transport(transport) {}
+
+    RemoteInput(const RemoteInput &) = delete;
+    RemoteInput &operator=(const RemoteInput &) = delete;
+
+    /**
+     * @brief Bind a channel to a source Var.
+     *
+     * @param channel Channel id published by the sending side.
+     * @param var Var receiving the values; its type must match the published one.
+     * @return RemoteInput& This input, for chaining.
+     */
+    template <SharedValue T, IsInvalidation IV, IsTrigger TR>
+    RemoteInput &bind(ChannelId channel, React<VarExpr, T, IV, TR> var) {
+        m_writers[channel] = {sizeof(T), [var = std::move(var)](const std::byte *data) mutable {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            var.value(value);
+        }};
+        return *this;
+    }
+
+    /**
+     * @brief Apply all frames pending on the transport.
+     *
+     * Entries for unbound channels are ignored.
+     * @return size_t Number of frames applied.
+     * @throws InvalidStateException if a frame is malformed.
+     * @throws TypeMismatchException if an entry's size differs from its Var's type.
+     */
+    size_t poll() {
+        size_t frames = 0;
+        while (m_transport.receive(m_frame)) {
+            apply();
+            ++frames;
+        }
+        return frames;
+    }
+
+    /// @brief Epoch of the sending graph carried by the last applied frame.
+    [[nodiscard]] uint64_t lastEpoch() const noexcept {
+        return m_lastEpoch;
+    }
+
+private:
+    /**
+     * @brief Writer of one bound channel.
+     */
+    struct Writer {
+        size_t size;                                  ///< Expected value size.
+        std::function<void(const std::byte *)> write; ///< Assigns the value to the Var.
+    };
+
+    void apply() {
+        remote::FrameHeader header{};
+        if (m_frame.size() < sizeof(header)) {
+            REACTION_THROW_INVALID_STATE("remote frame is truncated", "remote frame");
+        }
+        std::memcpy(&header, m_frame.data(), sizeof(header));
+
+        // Validate the whole frame before writing anything
+        m_pending.clear();
+        size_t offset = sizeof(header);
+        for (uint32_t i = 0; i < header.count; ++i) {
+            remote::EntryHeader entry{};
+            if (offset + sizeof(entry) > m_frame.size()) {
+                REACTION_THROW_INVALID_STATE("remote frame is truncated", "remote frame");
+            }
+            std::memcpy(&entry, m_frame.data() + offset, sizeof(entry));
+            if (offset + remote::entrySize(entry.size) > m_frame.size()) {
+                REACTION_THROW_INVALID_STATE("remote frame is truncated", "remote frame");
+            }
+            if (auto it = m_writers.find(entry.channel); it != m_writers.end()) {
+                if (it->second.size != entry.size) {
+                    REACTION_THROW_TYPE_MISMATCH(std::to_string(it->second.size) + " bytes", std::to_string(entry.size) + " bytes");
+                }
+                m_pending.push_back({&it->second, m_frame.data() + offset + sizeof(entry)});
+            }
+            offset += remote::entrySize(entry.size);
+        }
+
+        if (!m_pending.empty()) {
+            batchExecute([this]() {
+                for (auto &[writer, data] : m_pending) {
+                    writer->write(data);
+                }
+            });
+        }
+        m_lastEpoch = header.epoch;
+    }
+
+    Transport &m_transport;                                          ///< Incoming transport.
+    std::unordered_map<ChannelId, Writer> m_writers;                 ///< Bound channels.
+    std::vector<std::byte> m_frame;                                  ///< Reused receive buffer.
+    std::vector<std::pair<Writer *, const std::byte *>> m_pending;   ///< Entries of the frame being applied.
+    uint64_t m_lastEpoch{0};                                         ///< Remote epoch of the last frame.
+};
+
+} // namespace reaction
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/exception.h"
+#include "reaction/factory/reactive_factory.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define REACTION_HAS_SHM 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define REACTION_HAS_SHM 0
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Values that can be mirrored into shared memory.
+ */
+template <typename T>
+concept SharedValue = std::is_trivially_copyable_v<T> && !std::is_const_v<T>;
+
+/**
+ * @brief Layout of a shared-memory value segment.
+ *
+ * A fixed header is followed by a directory of named entries and then by
+ * one slot per entry. Each slot is a sequence counter followed by the value
+ * stored as 64-bit words; the counter is odd while a write is in progress,
+ * so readers retry until they observe the same even count before and after
+ * copying the words (a seqlock). All fields are lock-free atomics, which are
+ * address-free and therefore valid across processes.
+ */
+namespace shm {
+
+inline constexpr uint64_t MAGIC = 0x3176534D48535852ULL; // "RXSHMSv1"
+inline constexpr size_t NAME_SIZE = 48;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared slots need lock-free 64-bit atomics");
+
+struct SegmentHeader {
+    uint64_t magic;
+    uint32_t capacity;                  ///< Maximum number of entries.
+    uint32_t slotWords;                 ///< Value words per slot.
+    std::atomic<uint32_t> entryCount;   ///< Published directory entries.
+    uint32_t reserved;
+};
+
+struct DirectoryEntry {
+    std::array<char, NAME_SIZE> name;
+    uint32_t valueSize;                 ///< sizeof the exported type.
+    uint32_t reserved;
+};
+
+/// @brief Number of 64-bit words a slot needs for its counter and value.
+constexpr size_t slotStride(size_t slotWords) noexcept {
+    return 1 + slotWords;
+}
+
+/// @brief Total size of a segment.
+constexpr size_t segmentSize(size_t capacity, size_t slotWords) noexcept {
+    return sizeof(SegmentHeader) + capacity * sizeof(DirectoryEntry) + capacity * slotStride(slotWords) * sizeof(uint64_t);
+}
+
+} // namespace shm
+
+/**
+ * @brief Owning POSIX shared-memory mapping.
+ */
+class SharedSegment {
+public:
+    SharedSegment() = default;
+
+    /**
+     * @brief Create or open a segment.
+     * @param name Segment name, e.g. "/risk"; must start with '/'.
+     * @param size Size to map; when creating, the segment is resized to it.
+     * @param create Whether to create (and later unlink) the segment.
+     * @throws InvalidStateException if the segment cannot be created or opened.
+     */
+    SharedSegment(std::string name, size_t size, bool create) : m_name(std::move(name)), m_owner(create) {
+#if REACTION_HAS_SHM
+        int fd = ::shm_open(m_name.c_str(), create ? (O_CREAT | O_RDWR | O_TRUNC) : O_RDONLY, 0600);
+        if (fd < 0) {
+            REACTION_THROW_INVALID_STATE("cannot open shared memory '" + m_name + "'", "shared memory segment");
+        }
+        if (create && ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::shm_unlink(m_name.c_str());
+            REACTION_THROW_INVALID_STATE("cannot size shared memory '" + m_name + "'", "shared memory segment");
+        }
+        if (!create) {
+            struct stat st {};
+            if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(shm::SegmentHeader)) {
+                ::close(fd);
+                REACTION_THROW_INVALID_STATE("shared memory '" + m_name + "' is truncated", "shared memory segment");
+            }
+            size = static_cast<size_t>(st.st_size);
+        }
+        void *addr = ::mmap(nullptr, size, create ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            if (create) ::shm_unlink(m_name.c_str());
+            REACTION_THROW_INVALID_STATE("cannot map shared memory '" + m_name + "'", "shared memory segment");
+        }
+        m_data = static_cast<std::byte *>(addr);
+        m_size = size;
+#else
+        (void)size;
+        REACTION_THROW_INVALID_STATE("shared memory is not supported on this platform", "POSIX shared memory");
+#endif
+    }
+
+    ~SharedSegment() {
+        release();
+    }
+
+    SharedSegment(const SharedSegment &) = delete;
+    SharedSegment &operator=(const SharedSegment &) = delete;
+
+    SharedSegment(SharedSegment &&other) noexcept {
+        *this = std::move(other);
+    }
+
+    SharedSegment &operator=(SharedSegment &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_name = std::move(other.m_name);
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_owner = std::exchange(other.m_owner, false);
+        }
+        return *this;
+    }
+
+    /// @brief First byte of the mapping.
+    [[nodiscard]] std::byte *data() const noexcept {
+        return m_data;
+    }
+
+    /// @brief Size of the mapping in bytes.
+    [[nodiscard]] size_t size() const noexcept {
+        return m_size;
+    }
+
+private:
+    void release() noexcept {
+#if REACTION_HAS_SHM
+        if (m_data) {
+            ::munmap(m_data, m_size);
+        }
+        if (m_owner) {
+            ::shm_unlink(m_name.c_str());
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_owner = false;
+    }
+
+    std::string m_name;         ///< Segment name.
+    std::byte *m_data{nullptr}; ///< Start of the mapping.
+    size_t m_size{0};           ///< Size of the mapping.
+    bool m_owner{false};        ///< Whether this mapping created the segment.
+};
+
+namespace shm {
+
+/// @brief View of one seqlock slot inside a mapped segment.
+class SlotView {
+public:
+    explicit SlotView(std::atomic<uint64_t> *words) noexcept : m_words(words) {}
+
+    /**
+     * @brief Write a value; concurrent writers to the same slot serialize on the counter.
+     */
+    void write(const void *value, size_t size) const noexcept {
+        WordBuffer buffer(size);
+        std::memcpy(buffer.data(), value, size);
+
+        uint64_t seq = m_words[0].load(std::memory_order_relaxed);
+        do {
+            seq &= ~uint64_t{1};
+        } while (!m_words[0].compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+        // Release stores keep the odd counter ordered before the new words
+        for (size_t i = 0; i < buffer.words(); ++i) {
+            m_words[1 + i].store(buffer.data()[i], std::memory_order_release);
+        }
+        m_words[0].store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Attempt a consistent read.
+     * @return true if no write overlapped the copy.
+     */
+    bool tryRead(void *value, size_t size) const noexcept {
+        WordBuffer buffer(size);
+        const uint64_t before = m_words[0].load(std::memory_order_acquire);
+        if (before & 1) return false;
+        // Acquire loads keep the second counter read after the words
+        for (size_t i = 0; i < buffer.words(); ++i) {
+            buffer.data()[i] = m_words[1 + i].load(std::memory_order_acquire);
+        }
+        if (m_words[0].load(std::memory_order_relaxed) != before) return false;
+
+        std::memcpy(value, buffer.data(), size);
+        return true;
+    }
+
+    /// @brief Number of completed writes.
+    [[nodiscard]] uint64_t version() const noexcept {
+        return m_words[0].load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    /// @brief Word-aligned staging copy of a value; small values stay on the stack.
+    class WordBuffer {
+    public:
+        explicit WordBuffer(size_t size) : m_words((size + sizeof(uint64_t) - 1) / sizeof(uint64_t)) {
+            if (m_words > m_local.size()) m_heap.resize(m_words);
+            if (m_words > 0) data()[m_words - 1] = 0;
+        }
+        [[nodiscard]] uint64_t *data() noexcept {
+            return m_heap.empty() ? m_local.data() : m_heap.data();
+        }
+        [[nodiscard]] size_t words() const noexcept {
+            return m_words;
+        }
+
+    private:
+        size_t m_words;
+        std::array<uint64_t, 16> m_local;
+        std::vector<uint64_t> m_heap;
+    };
+
+    std::atomic<uint64_t> *m_words; ///< Counter followed by the value words.
+};
+
+} // namespace shm
+
+/**
+ * @brief Mirrors selected node values into a POSIX shared-memory segment.
+ *
+ * Every exported node gets a named slot; an action keeps the slot up to date
+ * whenever the node changes, so readers in other processes see the latest
+ * value without sockets or serialization. The segment is removed when the
+ * exporter is destroyed.
+ */
+class SharedMemoryExporter {
+public:
+    /**
+     * @brief Create a segment.
+     * @param name Segment name, e.g. "/risk".
+     * @param capacity Maximum number of exported nodes.
+     * @param maxValueSize Largest exported value in bytes.
+     * @throws InvalidStateException if the segment cannot be created.
+     */
+    SharedMemoryExporter(std::string name, uint32_t capacity, size_t maxValueSize = 64)
+        : m_slotWords((maxValueSize + sizeof(uint64_t) - 1) / sizeof(uint64_t)),
+          m_segment(std::move(name), shm::segmentSize(capacity, m_slotWords), true) {
+        auto *header = new (m_segment.data()) shm::SegmentHeader{};
+        header->capacity = capacity;
+        header->slotWords = static_cast<uint32_t>(m_slotWords);
+        header->entryCount.store(0, std::memory_order_relaxed);
+        for (uint32_t i = 0; i < capacity; ++i) {
+            std::uninitialized_value_construct_n(slotWords(i), shm::slotStride(m_slotWords));
+        }
+        header->magic = shm::MAGIC;
+    }
+
+    ~SharedMemoryExporter() {
+        for (auto &closer : m_closers) {
+            closer();
+        }
+    }
+
+    SharedMemoryExporter(const SharedMemoryExporter &) = delete;
+    SharedMemoryExporter &operator=(const SharedMemoryExporter &) = delete;
+
+    /**
+     * @brief Export a node under a name.
+     *
+     * The current value is written immediately and on every later change.
+     *
+     * @param name Entry name, at most shm::NAME_SIZE - 1 characters.
+     * @param source Var or calc to mirror.
+     * @return SharedMemoryExporter& This exporter, for chaining.
+     * @throws InvalidStateException if the segment is full, the name is taken or too long, or the value too large.
+     */
+    template <IsReact R>
+        requires SharedValue<std::remove_cvref_t<typename std::remove_cvref_t<R>::value_type>>
+    SharedMemoryExporter &publish(std::string_view name, const R &source) {
+        using T = std::remove_cvref_t<typename std::remove_cvref_t<R>::value_type>;
+        const uint32_t index = addEntry(name, sizeof(T));
+        shm::SlotView slot(slotWords(index));
+        auto mirror = reaction::action([slot](const T &value) {
+            slot.write(&value, sizeof(T));
+        }, source);
+        m_closers.push_back([mirror]() mutable {
+            if (mirror) mirror.close();
+        });
+        return *this;
+    }
+
+    /// @brief Number of exported nodes.
+    [[nodiscard]] size_t size() const noexcept {
+        return header().entryCount.load(std::memory_order_acquire);
+    }
+
+private:
+    [[nodiscard]] shm::SegmentHeader &header() const noexcept {
+        return *reinterpret_cast<shm::SegmentHeader *>(m_segment.data());
+    }
+
+    [[nodiscard]] shm::DirectoryEntry *directory() const noexcept {
+        return reinterpret_cast<shm::DirectoryEntry *>(m_segment.data() + sizeof(shm::SegmentHeader));
+    }
+
+    [[nodiscard]] std::atomic<uint64_t> *slotWords(uint32_t index) const noexcept {
+        auto *first = reinterpret_cast<std::atomic<uint64_t> *>(directory() + header().capacity);
+        return first + index * shm::slotStride(m_slotWords);
+    }
+
+    uint32_t addEntry(std::string_view name, size_t valueSize) {
+        ConditionalUniqueLock<ConditionalMutex> lock(m_directoryMutex);
+        const uint32_t count = header().entryCount.load(std::memory_order_relaxed);
+        if (count >= header().capacity) {
+            REACTION_THROW_INVALID_STATE("shared memory segment is full", "free slot");
+        }
+        if (name.empty() || name.size() >= shm::NAME_SIZE) {
+            REACTION_THROW_INVALID_STATE("entry name '" + std::string(name) + "' is empty or too long", "shorter name");
+        }
+        if (valueSize > m_slotWords * sizeof(uint64_t)) {
+            REACTION_THROW_INVALID_STATE("value of '" + std::string(name) + "' exceeds the slot size", "larger slots");
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            if (std::string_view(directory()[i].name.data()) == name) {
+                REACTION_THROW_INVALID_STATE("entry '" + std::string(name) + "' already exported", "unique name");
+            }
+        }
+
+        shm::DirectoryEntry &entry = directory()[count];
+        entry = {};
+        std::copy(name.begin(), name.end(), entry.name.begin());
+        entry.valueSize = static_cast<uint32_t>(valueSize);
+        // Readers only look at entries below the published count
+        header().entryCount.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    size_t m_slotWords;                           ///< Value words per slot.
+    SharedSegment m_segment;                      ///< The created segment.
+    ConditionalMutex m_directoryMutex;            ///< Serializes directory updates.
+    std::vector<std::function<void()>> m_closers; ///< Close the mirroring actions.
+};
+
+/**
+ * @brief Reader-side handle of one exported value.
+ *
+ * @tparam T Type the value was exported with.
+ */
+template <SharedValue T>
+class SharedSlot {
+public:
+    explicit SharedSlot(shm::SlotView slot) noexcept : m_slot(slot) {}
+
+    /**
+     * @brief Read the latest value, retrying while a write is in progress.
+     */
+    [[nodiscard]] T get() const noexcept {
+        T value;
+        while (!m_slot.tryRead(&value, sizeof(T))) {
+        }
+        return value;
+    }
+
+    /**
+     * @brief Read the latest value without waiting.
+     * @return The value, or std::nullopt if a write overlapped the read.
+     */
+    [[nodiscard]] std::optional<T> tryGet() const noexcept {
+        T value;
+        if (!m_slot.tryRead(&value, sizeof(T))) return std::nullopt;
+        return value;
+    }
+
+    /// @brief Number of values written so far; changes whenever the value is updated.
+    [[nodiscard]] uint64_t version() const noexcept {
+        return m_slot.version();
+    }
+
+private:
+    shm::SlotView m_slot; ///< Slot in the mapped segment.
+};
+
+/**
+ * @brief Opens a segment created by a SharedMemoryExporter, usually in another process.
+ */
+class SharedMemoryReader {
+public:
+    /**
+     * @brief Map an existing segment read-only.
+     * @param name Segment name used by the exporter.
+     * @throws InvalidStateException if the segment does not exist or is not a value segment.
+     */
+    explicit SharedMemoryReader(std::string name) : m_segment(std::move(name), 0, false) {
+        if (header().magic != shm::MAGIC ||
+            m_segment.size() < shm::segmentSize(header().capacity, header().slotWords)) {
+            REACTION_THROW_INVALID_STATE("not a shared value segment", "shared value segment");
+        }
+    }
+
+    /// @brief Names of all exported values, in export order.
+    [[nodiscard]] std::vector<std::string> names() const {
+        std::vector<std::string> result;
+        const uint32_t count = header().entryCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            result.emplace_back(directory()[i].name.data());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Look up an exported value.
+     *
+     * @tparam T Type the value was exported with.
+     * @param name Entry name.
+     * @return SharedSlot<T> Handle for reading the value.
+     * @throws InvalidStateException if no such entry exists.
+     * @throws TypeMismatchException if the entry holds a value of a different size.
+     */
+    template <SharedValue T>
+    [[nodiscard]] SharedSlot<T> find(std::string_view name) const {
+        const uint32_t count = header().entryCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            const shm::DirectoryEntry &entry = directory()[i];
+            if (std::string_view(entry.name.data()) != name) continue;
+            if (entry.valueSize != sizeof(T)) {
+                REACTION_THROW_TYPE_MISMATCH(std::to_string(sizeof(T)) + " bytes", std::to_string(entry.valueSize) + " bytes");
+            }
+            auto *first = reinterpret_cast<std::atomic<uint64_t> *>(directory() + header().capacity);
+            return SharedSlot<T>(shm::SlotView(first + i * shm::slotStride(header().slotWords)));
+        }
+        REACTION_THROW_INVALID_STATE("entry '" + std::string(name) + "' missing", "exported entry");
+    }
+
+private:
+    [[nodiscard]] const shm::SegmentHeader &header() const noexcept {
+        return *reinterpret_cast<const shm::SegmentHeader *>(m_segment.data());
+    }
+
+    [[nodiscard]] shm::DirectoryEntry *directory() const noexcept {
+        return reinterpret_cast<shm::DirectoryEntry *>(m_segment.data() + sizeof(shm::SegmentHeader));
+    }
+
+    SharedSegment m_segment; ///< Read-only mapping.
+};
+
+} // namespace reaction
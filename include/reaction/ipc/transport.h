@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/exception.h"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define REACTION_HAS_UNIX_SOCKETS 1
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#else
+#define REACTION_HAS_UNIX_SOCKETS 0
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Message transport between graph partitions.
+ *
+ * A transport moves whole frames: every send() is delivered as exactly one
+ * frame by receive(), in order. Implementations may block in send() but
+ * receive() must return immediately when no frame is pending.
+ */
+class Transport {
+public:
+    virtual ~Transport() = default;
+
+    /**
+     * @brief Send one frame.
+     * @param frame Bytes of the frame.
+     * @throws InvalidStateException if the peer is gone.
+     */
+    virtual void send(std::span<const std::byte> frame) = 0;
+
+    /**
+     * @brief Receive one frame without blocking.
+     * @param frame Receives the bytes of the frame.
+     * @return true if a frame was received, false if none was pending.
+     */
+    virtual bool receive(std::vector<std::byte> &frame) = 0;
+};
+
+/**
+ * @brief Transport over a Unix domain socket.
+ *
+ * Uses SOCK_SEQPACKET, which preserves frame boundaries and ordering, so
+ * no framing layer is needed. Endpoints are either created as a connected
+ * pair (e.g. before fork()) or through a listening socket bound to a path.
+ */
+class UnixSocketTransport final : public Transport {
+public:
+    /**
+     * @brief Create two connected endpoints.
+     * @return std::pair<UnixSocketTransport, UnixSocketTransport> The endpoints.
+     * @throws InvalidStateException if the sockets cannot be created.
+     */
+    [[nodiscard]] static std::pair<UnixSocketTransport, UnixSocketTransport> pair() {
+#if REACTION_HAS_UNIX_SOCKETS
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds) != 0) {
+            REACTION_THROW_INVALID_STATE("cannot create socket pair", "unix socket");
+        }
+        return {UnixSocketTransport(fds[0]), UnixSocketTransport(fds[1])};
+#else
+        REACTION_THROW_INVALID_STATE("unix sockets are not supported on this platform", "unix socket");
+#endif
+    }
+
+    /**
+     * @brief Connect to a listening endpoint.
+     * @param path Socket path passed to UnixSocketListener.
+     * @throws InvalidStateException if the connection fails.
+     */
+    [[nodiscard]] static UnixSocketTransport connect(const std::string &path) {
+#if REACTION_HAS_UNIX_SOCKETS
+        UnixSocketTransport transport(::socket(AF_UNIX, SOCK_SEQPACKET, 0));
+        sockaddr_un addr = address(path);
+        if (transport.m_fd < 0 || ::connect(transport.m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) {
+            REACTION_THROW_INVALID_STATE("cannot connect to '" + path + "'", "listening unix socket");
+        }
+        return transport;
+#else
+        REACTION_THROW_INVALID_STATE("unix sockets are not supported on this platform", "unix socket");
+#endif
+    }
+
+    ~UnixSocketTransport() override {
+        release();
+    }
+
+    UnixSocketTransport(const UnixSocketTransport &) = delete;
+    UnixSocketTransport &operator=(const UnixSocketTransport &) = delete;
+
+    UnixSocketTransport(UnixSocketTransport &&other) noexcept : m_fd(std::exchange(other.m_fd, -1)) {}
+
+    UnixSocketTransport &operator=(UnixSocketTransport &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_fd = std::exchange(other.m_fd, -1);
+        }
+        return *this;
+    }
+
+    void send(std::span<const std::byte> frame) override {
+#if REACTION_HAS_UNIX_SOCKETS
+        ssize_t sent;
+        do {
+            sent = ::send(m_fd, frame.data(), frame.size(), SEND_FLAGS);
+        } while (sent < 0 && errno == EINTR);
+        if (sent != static_cast<ssize_t>(frame.size())) {
+            REACTION_THROW_INVALID_STATE("unix socket send failed", "connected peer");
+        }
+#else
+        (void)frame;
+#endif
+    }
+
+    bool receive(std::vector<std::byte> &frame) override {
+#if REACTION_HAS_UNIX_SOCKETS
+        // Peek with MSG_TRUNC to learn the size of the pending frame
+        std::byte probe;
+        ssize_t size = ::recv(m_fd, &probe, 1, MSG_PEEK | MSG_TRUNC | MSG_DONTWAIT);
+        if (size <= 0) {
+            return false;
+        }
+        frame.resize(static_cast<size_t>(size));
+        return ::recv(m_fd, frame.data(), frame.size(), MSG_DONTWAIT) == size;
+#else
+        (void)frame;
+        return false;
+#endif
+    }
+
+private:
+    friend class UnixSocketListener;
+
+    explicit UnixSocketTransport(int fd) noexcept : m_fd(fd) {}
+
+#if REACTION_HAS_UNIX_SOCKETS
+#ifdef MSG_NOSIGNAL
+    static constexpr int SEND_FLAGS = MSG_NOSIGNAL; ///< Report a closed peer as an error, not SIGPIPE.
+#else
+    static constexpr int SEND_FLAGS = 0;
+#endif
+
+    static sockaddr_un address(const std::string &path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) {
+            REACTION_THROW_INVALID_STATE("socket path '" + path + "' too long", "shorter path");
+        }
+        path.copy(addr.sun_path, path.size());
+        return addr;
+    }
+#endif
+
+    void release() noexcept {
+#if REACTION_HAS_UNIX_SOCKETS
+        if (m_fd >= 0) {
+            ::close(m_fd);
+        }
+#endif
+        m_fd = -1;
+    }
+
+    int m_fd{-1}; ///< Connected socket.
+};
+
+/**
+ * @brief Listening Unix domain socket accepting UnixSocketTransport peers.
+ *
+ * The socket file is removed when the listener is destroyed.
+ */
+class UnixSocketListener {
+public:
+    /**
+     * @brief Bind and listen on a path.
+     * @param path Socket path; an existing file at the path is replaced.
+     * @throws InvalidStateException if the socket cannot be bound.
+     */
+    explicit UnixSocketListener(std::string path) : m_path(std::move(path)) {
+#if REACTION_HAS_UNIX_SOCKETS
+        sockaddr_un addr = UnixSocketTransport::address(m_path);
+        ::unlink(m_path.c_str());
+        m_fd = ::socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        if (m_fd < 0 || ::bind(m_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || ::listen(m_fd, 8) != 0) {
+            release();
+            REACTION_THROW_INVALID_STATE("cannot listen on '" + m_path + "'", "bindable socket path");
+        }
+#else
+        REACTION_THROW_INVALID_STATE("unix sockets are not supported on this platform", "unix socket");
+#endif
+    }
+
+    ~UnixSocketListener() {
+        release();
+    }
+
+    UnixSocketListener(const UnixSocketListener &) = delete;
+    UnixSocketListener &operator=(const UnixSocketListener &) = delete;
+
+    /**
+     * @brief Wait for and accept one peer.
+     * @return UnixSocketTransport The connected endpoint.
+     * @throws InvalidStateException if accepting fails.
+     */
+    [[nodiscard]] UnixSocketTransport accept() {
+#if REACTION_HAS_UNIX_SOCKETS
+        int fd;
+        do {
+            fd = ::accept(m_fd, nullptr, nullptr);
+        } while (fd < 0 && errno == EINTR);
+        if (fd < 0) {
+            REACTION_THROW_INVALID_STATE("accept on '" + m_path + "' failed", "connecting peer");
+        }
+        return UnixSocketTransport(fd);
+#else
+        return UnixSocketTransport(-1);
+#endif
+    }
+
+private:
+    void release() noexcept {
+#if REACTION_HAS_UNIX_SOCKETS
+        if (m_fd >= 0) {
+            ::close(m_fd);
+            ::unlink(m_path.c_str());
+        }
+#endif
+        m_fd = -1;
+    }
+
+    std::string m_path; ///< Socket path.
+    int m_fd{-1};       ///< Listening socket.
+};
+
+} // namespace reaction
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Compile-time switch for allocation accounting
+#ifndef REACTION_ALLOC_TRACKING
+#define REACTION_ALLOC_TRACKING 0
+#endif
+
+namespace reaction {
+
+/**
+ * @brief Parts of the framework that allocations are attributed to.
+ */
+enum class AllocSubsystem : uint8_t {
+    OTHER,    ///< Outside any tagged operation, including user code.
+    CREATION, ///< Creating a node through the factory functions.
+    WRITE,    ///< Assigning a value to a var, up to propagation.
+    BATCH,    ///< Building and executing a batch.
+    NOTIFY,   ///< Snapshotting observer sets for notification.
+    GRAPH,    ///< Observer graph bookkeeping and traversal.
+};
+
+/// @brief Number of allocation subsystems.
+inline constexpr size_t ALLOC_SUBSYSTEM_COUNT = static_cast<size_t>(AllocSubsystem::GRAPH) + 1;
+
+/// @brief Human-readable name of an allocation subsystem.
+constexpr const char *allocSubsystemName(AllocSubsystem subsystem) noexcept {
+    switch (subsystem) {
+    case AllocSubsystem::OTHER: return "other";
+    case AllocSubsystem::CREATION: return "creation";
+    case AllocSubsystem::WRITE: return "write";
+    case AllocSubsystem::BATCH: return "batch";
+    case AllocSubsystem::NOTIFY: return "notify";
+    case AllocSubsystem::GRAPH: return "graph";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Allocation counts of one subsystem.
+ */
+struct AllocCounts {
+    uint64_t allocations = 0; ///< Number of allocations.
+    uint64_t bytes = 0;       ///< Bytes requested.
+};
+
+/**
+ * @brief Process-wide allocation counters, attributed by subsystem.
+ *
+ * The framework tags its operations with AllocScope; an allocation counts
+ * towards the innermost tag active on the allocating thread. Counting itself
+ * happens in the allocator: define REACTION_ALLOC_TRACKING=1 and place
+ * REACTION_DEFINE_TRACKING_OPERATOR_NEW() in exactly one translation unit to
+ * route every global operator new through record(). Allocations made through
+ * any other allocator can be reported by calling record() directly.
+ *
+ * Without the switch the scopes compile to nothing and all allocations count
+ * as OTHER.
+ */
+class AllocTracker {
+public:
+    /// @brief Whether subsystem tagging is compiled in.
+    static constexpr bool ENABLED = REACTION_ALLOC_TRACKING != 0;
+
+    /**
+     * @brief Get the singleton instance.
+     * @return AllocTracker& Reference to the singleton instance.
+     */
+    static AllocTracker &getInstance() noexcept {
+        static AllocTracker instance;
+        return instance;
+    }
+
+    /// @brief Count an allocation against the calling thread's current subsystem.
+    void record(size_t bytes) noexcept {
+        record(current(), bytes);
+    }
+
+    /// @brief Count an allocation against a subsystem.
+    void record(AllocSubsystem subsystem, size_t bytes) noexcept {
+        Counters &counters = m_counters[static_cast<size_t>(subsystem)];
+        counters.allocations.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /// @brief Counts of one subsystem.
+    [[nodiscard]] AllocCounts snapshot(AllocSubsystem subsystem) const noexcept {
+        const Counters &counters = m_counters[static_cast<size_t>(subsystem)];
+        return {counters.allocations.load(std::memory_order_relaxed), counters.bytes.load(std::memory_order_relaxed)};
+    }
+
+    /// @brief Counts summed over all subsystems.
+    [[nodiscard]] AllocCounts total() const noexcept {
+        AllocCounts sum;
+        for (size_t i = 0; i < ALLOC_SUBSYSTEM_COUNT; ++i) {
+            AllocCounts counts = snapshot(static_cast<AllocSubsystem>(i));
+            sum.allocations += counts.allocations;
+            sum.bytes += counts.bytes;
+        }
+        return sum;
+    }
+
+    /// @brief Zero all counters.
+    void reset() noexcept {
+        for (Counters &counters : m_counters) {
+            counters.allocations.store(0, std::memory_order_relaxed);
+            counters.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Subsystem the calling thread's allocations are currently attributed to.
+    [[nodiscard]] static AllocSubsystem current() noexcept {
+        if constexpr (ENABLED) {
+            return t_current;
+        } else {
+            return AllocSubsystem::OTHER;
+        }
+    }
+
+private:
+    friend class AllocScope;
+
+    /**
+     * @brief Live counters of one subsystem.
+     */
+    struct Counters {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> bytes{0};
+    };
+
+    constexpr AllocTracker() noexcept = default;
+    AllocTracker(const AllocTracker &) = delete;
+    AllocTracker &operator=(const AllocTracker &) = delete;
+
+    inline static thread_local AllocSubsystem t_current = AllocSubsystem::OTHER;
+
+    std::array<Counters, ALLOC_SUBSYSTEM_COUNT> m_counters; ///< Counters per subsystem.
+};
+
+/**
+ * @brief RAII tag attributing the calling thread's allocations to a subsystem.
+ *
+ * Scopes nest; the previous subsystem is restored on destruction.
+ */
+class AllocScope {
+public:
+    explicit AllocScope([[maybe_unused]] AllocSubsystem subsystem) noexcept {
+        if constexpr (AllocTracker::ENABLED) {
+            m_previous = AllocTracker::t_current;
+            AllocTracker::t_current = subsystem;
+        }
+    }
+
+    ~AllocScope() {
+        if constexpr (AllocTracker::ENABLED) {
+            AllocTracker::t_current = m_previous;
+        }
+    }
+
+    AllocScope(const AllocScope &) = delete;
+    AllocScope &operator=(const AllocScope &) = delete;
+
+private:
+    [[maybe_unused]] AllocSubsystem m_previous = AllocSubsystem::OTHER; ///< Subsystem restored on exit.
+};
+
+} // namespace reaction
+
+#if defined(_MSC_VER)
+#define REACTION_ALIGNED_ALLOC(alignment, size) _aligned_malloc(size, alignment)
+#define REACTION_ALIGNED_FREE(ptr) _aligned_free(ptr)
+#define REACTION_DELETE_NOINLINE
+#else
+#define REACTION_ALIGNED_ALLOC(alignment, size) std::aligned_alloc(alignment, ((size) + (alignment) - 1) / (alignment) * (alignment))
+#define REACTION_ALIGNED_FREE(ptr) std::free(ptr)
+// Keeps GCC from pairing an inlined free() with new-expressions in -Wmismatched-new-delete
+#define REACTION_DELETE_NOINLINE __attribute__((noinline))
+#endif
+
+/**
+ * @brief Replace the global operator new/delete with versions that report to AllocTracker.
+ *
+ * Use in exactly one translation unit of a program, e.g. a benchmark or
+ * profiling build. The array and nothrow forms forward to these by default.
+ */
+#define REACTION_DEFINE_TRACKING_OPERATOR_NEW()                                             \
+    void *operator new(std::size_t size) {                                                  \
+        ::reaction::AllocTracker::getInstance().record(size);                               \
+        if (void *ptr = std::malloc(size ? size : 1)) return ptr;                           \
+        throw std::bad_alloc();                                                             \
+    }                                                                                       \
+    void *operator new(std::size_t size, std::align_val_t alignment) {                      \
+        ::reaction::AllocTracker::getInstance().record(size);                               \
+        const auto align = static_cast<std::size_t>(alignment);                             \
+        if (void *ptr = REACTION_ALIGNED_ALLOC(align, size ? size : 1)) return ptr;         \
+        throw std::bad_alloc();                                                             \
+    }                                                                                       \
+    REACTION_DELETE_NOINLINE void operator delete(void *ptr) noexcept {                     \
+        std::free(ptr);                                                                     \
+    }                                                                                       \
+    REACTION_DELETE_NOINLINE void operator delete(void *ptr, std::size_t) noexcept {        \
+        std::free(ptr);                                                                     \
+    }                                                                                       \
+    REACTION_DELETE_NOINLINE void operator delete(void *ptr, std::align_val_t) noexcept {   \
+        REACTION_ALIGNED_FREE(ptr);                                                         \
+    }                                                                                       \
+    REACTION_DELETE_NOINLINE void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept { \
+        REACTION_ALIGNED_FREE(ptr);                                                         \
+    }
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+
+namespace reaction {
+
+/**
+ * @brief Memory resource backing the graph's internal containers.
+ *
+ * The observer and dependency maps of ObserverGraph, the observer set of
+ * every node and the entries of the graph caches all allocate from this
+ * resource. It defaults to the global heap and is replaced through
+ * ObserverGraph::useMemoryResource() while the graph is empty.
+ */
+class GraphMemory {
+public:
+    /**
+     * @brief Get the singleton instance.
+     * @return GraphMemory& singleton reference.
+     */
+    [[nodiscard]] static GraphMemory &getInstance() noexcept {
+        static GraphMemory instance;
+        return instance;
+    }
+
+    /// @brief Resource new graph containers allocate from.
+    [[nodiscard]] std::pmr::memory_resource *resource() const noexcept {
+        return m_resource.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class ObserverGraph;
+
+    GraphMemory() = default;
+
+    /**
+     * @brief Switch to a resource, releasing the pool owned so far.
+     * @param resource New resource.
+     * @param pool Pool owning resource, if the graph owns it.
+     */
+    void set(std::pmr::memory_resource *resource, std::unique_ptr<std::pmr::memory_resource> pool) noexcept {
+        m_resource.store(resource, std::memory_order_release);
+        m_ownedPool = std::move(pool);
+    }
+
+    std::atomic<std::pmr::memory_resource *> m_resource{std::pmr::new_delete_resource()}; ///< Current resource.
+    std::unique_ptr<std::pmr::memory_resource> m_ownedPool;                              ///< Pool installed by usePooledMemory().
+};
+
+} // namespace reaction
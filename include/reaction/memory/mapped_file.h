@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/exception.h"
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define REACTION_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define REACTION_HAS_MMAP 0
+#endif
+
+namespace reaction::memory {
+
+/**
+ * @brief How a file is mapped.
+ */
+enum class MapMode {
+    READ_ONLY,     ///< Pages are shared with the page cache and cannot be written.
+    COPY_ON_WRITE, ///< Pages are writable; written pages become private copies and the file is never modified.
+};
+
+/**
+ * @brief Expected access pattern, used to tune kernel read-ahead.
+ */
+enum class AccessHint {
+    SEQUENTIAL, ///< Scanned front to back, e.g. replay.
+    RANDOM,     ///< Random lookups, e.g. reference data.
+    NORMAL,     ///< No particular pattern.
+};
+
+/**
+ * @brief View of a whole file.
+ *
+ * On POSIX systems the file is memory-mapped, so pages are loaded lazily by
+ * the kernel and large inputs never have to fit in the heap. Elsewhere the
+ * file is read into an owned buffer with the same interface.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief Map the given file.
+     * @param path Path of the file to open.
+     * @param mode Read-only or copy-on-write mapping.
+     * @param hint Expected access pattern.
+     * @throws InvalidStateException if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path, MapMode mode = MapMode::READ_ONLY, AccessHint hint = AccessHint::SEQUENTIAL)
+        : m_mode(mode) {
+#if REACTION_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            REACTION_THROW_INVALID_STATE("cannot open '" + path + "'", "readable file");
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            REACTION_THROW_INVALID_STATE("cannot stat '" + path + "'", "readable file");
+        }
+        m_size = static_cast<size_t>(st.st_size);
+        if (m_size > 0) {
+            const int prot = mode == MapMode::COPY_ON_WRITE ? (PROT_READ | PROT_WRITE) : PROT_READ;
+            void *addr = ::mmap(nullptr, m_size, prot, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                REACTION_THROW_INVALID_STATE("cannot map '" + path + "'", "mappable file");
+            }
+            if (hint != AccessHint::NORMAL) {
+                ::madvise(addr, m_size, hint == AccessHint::SEQUENTIAL ? MADV_SEQUENTIAL : MADV_RANDOM);
+            }
+            m_data = static_cast<std::byte *>(addr);
+        }
+        ::close(fd);
+#else
+        (void)hint;
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) {
+            REACTION_THROW_INVALID_STATE("cannot open '" + path + "'", "readable file");
+        }
+        m_buffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(reinterpret_cast<char *>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#endif
+    }
+
+    ~MappedFile() {
+        release();
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile &operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_mode = other.m_mode;
+            m_buffer = std::move(other.m_buffer);
+        }
+        return *this;
+    }
+
+    /// @brief First byte of the file, or nullptr if nothing is mapped.
+    [[nodiscard]] const std::byte *data() const noexcept {
+        return m_data;
+    }
+
+    /// @brief Writable first byte of a copy-on-write mapping, nullptr for read-only mappings.
+    [[nodiscard]] std::byte *mutableData() const noexcept {
+        return m_mode == MapMode::COPY_ON_WRITE ? m_data : nullptr;
+    }
+
+    /// @brief How the file is mapped.
+    [[nodiscard]] MapMode mode() const noexcept {
+        return m_mode;
+    }
+
+    /// @brief Size of the file in bytes.
+    [[nodiscard]] size_t size() const noexcept {
+        return m_size;
+    }
+
+    /// @brief Whether a non-empty file is mapped.
+    [[nodiscard]] bool isOpen() const noexcept {
+        return m_data != nullptr;
+    }
+
+private:
+    void release() noexcept {
+#if REACTION_HAS_MMAP
+        if (m_data && m_buffer.empty()) {
+            ::munmap(m_data, m_size);
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_buffer.clear();
+    }
+
+    std::byte *m_data{nullptr};            ///< Start of the mapped bytes.
+    size_t m_size{0};                      ///< Number of mapped bytes.
+    MapMode m_mode{MapMode::READ_ONLY};    ///< How the file is mapped.
+    std::vector<std::byte> m_buffer;  ///< Owned copy when memory mapping is unavailable.
+};
+
+} // namespace reaction::memory
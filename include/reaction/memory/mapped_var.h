@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/factory/reactive_factory.h"
+#include "reaction/memory/mapped_file.h"
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace reaction {
+
+/**
+ * @brief Array of T stored in a memory-mapped file.
+ *
+ * A cheap, copyable handle: copies share the mapping, which stays alive as
+ * long as any copy does. The file is the raw array, so opening it only maps
+ * it and pages are faulted in on access and managed by the page cache.
+ *
+ * The type deliberately has no equality operator: assigning a MappedArray
+ * to a Var always counts as a change, including re-assigning the same
+ * mapping after editing a copy-on-write view in place.
+ *
+ * @tparam T Trivially copyable element type.
+ */
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+class MappedArray {
+public:
+    using value_type = T;
+
+    /// @brief An empty array.
+    MappedArray() = default;
+
+    /**
+     * @brief Map a file holding an array of T.
+     *
+     * @param path Path of the file.
+     * @param mode Read-only or copy-on-write mapping.
+     * @param hint Expected access pattern; reference data is usually random access.
+     * @return MappedArray Handle to the mapped array.
+     * @throws InvalidStateException if the file cannot be mapped or its size is not a multiple of sizeof(T).
+     */
+    [[nodiscard]] static MappedArray open(const std::string &path, memory::MapMode mode = memory::MapMode::READ_ONLY,
+        memory::AccessHint hint = memory::AccessHint::RANDOM) {
+        auto file = std::make_shared<memory::MappedFile>(path, mode, hint);
+        if (file->size() % sizeof(T) != 0) {
+            REACTION_THROW_INVALID_STATE("size of '" + path + "' is not a multiple of the element size", "array file");
+        }
+        return MappedArray(std::move(file));
+    }
+
+    /// @brief Read-only view of all elements.
+    [[nodiscard]] std::span<const T> span() const noexcept {
+        return {data(), size()};
+    }
+
+    /**
+     * @brief Writable view of a copy-on-write mapping.
+     *
+     * Writes touch private copies of the affected pages only and never reach
+     * the file. Assign the array to its Var again to notify observers.
+     * @throws InvalidStateException if the array is mapped read-only.
+     */
+    [[nodiscard]] std::span<T> mutableSpan() const {
+        std::byte *bytes = m_file ? m_file->mutableData() : nullptr;
+        if (!bytes && size() > 0) {
+            REACTION_THROW_INVALID_STATE("array is mapped read-only", "copy-on-write mapping");
+        }
+        return {reinterpret_cast<T *>(bytes), size()};
+    }
+
+    [[nodiscard]] const T *data() const noexcept {
+        return m_file ? reinterpret_cast<const T *>(m_file->data()) : nullptr;
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return m_file ? m_file->size() / sizeof(T) : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] const T &operator[](size_t index) const noexcept {
+        return data()[index];
+    }
+
+    [[nodiscard]] const T *begin() const noexcept {
+        return data();
+    }
+
+    [[nodiscard]] const T *end() const noexcept {
+        return data() + size();
+    }
+
+private:
+    explicit MappedArray(std::shared_ptr<const memory::MappedFile> file) noexcept : m_file(std::move(file)) {}
+
+    std::shared_ptr<const memory::MappedFile> m_file; ///< Shared mapping.
+};
+
+/**
+ * @brief Var whose value is an array living in a memory-mapped file.
+ *
+ * Participates in the graph like any Var; assigning a new MappedArray swaps
+ * the mapping and notifies observers, while readers still holding the old
+ * array keep the old mapping alive until they drop it.
+ */
+template <typename T>
+using MappedVar = React<VarExpr, MappedArray<T>, KeepHandle, ChangeTrig>;
+
+/**
+ * @brief Create a MappedVar over a file.
+ *
+ * @tparam T Element type of the file.
+ * @param path Path of the file.
+ * @param mode Read-only or copy-on-write mapping.
+ * @return MappedVar<T> Var holding the mapped array.
+ */
+template <typename T>
+MappedVar<T> mappedVar(const std::string &path, memory::MapMode mode = memory::MapMode::READ_ONLY) {
+    return var(MappedArray<T>::open(path, mode));
+}
+
+} // namespace reaction
@@ -12,14 +12,17 @@
 #include "reaction/concurrency/thread_manager.h"
 #include "reaction/core/exception.h"
 #include "reaction/core/observer_node.h"
+#include "reaction/core/value_history.h"
 #include "reaction/core/concept.h"
 #include "reaction/graph/batch.h"  // For g_batch_execute
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <new>
 #include <shared_mutex>
 #include <type_traits>
+#include <utility>
 
 // Forward declare Void to avoid circular dependency
 namespace reaction {
@@ -132,6 +135,34 @@ public:
         }
     }
 
+    /**
+     * @brief Read part of the stored value without copying all of it (thread-safe).
+     *
+     * @param reader Called with a const reference to the value under the read lock.
+     * @return Whatever reader returns.
+     */
+    template <typename F>
+    decltype(auto) readValue(F &&reader) const {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_resourceMutex);
+        if (!is_initialized) {
+            REACTION_THROW_RESOURCE_NOT_INITIALIZED("SBOResource");
+        }
+        if constexpr (always_sbo) {
+            return std::invoke(std::forward<F>(reader), *reinterpret_cast<const Type*>(storage.buffer));
+        } else {
+            if (is_sbo_storage) {
+                return std::invoke(std::forward<F>(reader), *reinterpret_cast<const Type*>(storage.buffer));
+            }
+            return std::invoke(std::forward<F>(reader), std::as_const(*storage.heap_ptr));
+        }
+    }
+
+    /// @brief Whether a value is stored; getValue() throws otherwise.
+    [[nodiscard]] bool hasValue() const noexcept {
+        ConditionalSharedLock<ConditionalSharedMutex> lock(m_resourceMutex);
+        return is_initialized;
+    }
+
     /**
      * @brief Update the stored value.
      *
@@ -255,28 +286,23 @@ public:
         bool changed = false;
         {
             ConditionalUniqueLock<ConditionalSharedMutex> lock(m_resourceMutex);
-            try {
-                // Direct access to avoid lock recursion
-                if (!is_initialized) {
-                    REACTION_THROW_RESOURCE_NOT_INITIALIZED("SBOResource");
-                }
-
+            // Direct access to avoid lock recursion; an uninitialized resource is left unchanged
+            if (is_initialized) {
                 if (is_sbo_storage) {
                     Type* ptr = reinterpret_cast<Type*>(const_cast<char*>(storage.buffer));
                     changed = operation(*ptr);
                 } else {
                     changed = operation(*storage.heap_ptr);
                 }
-
-                if (alwaysChanged) {
-                    changed = true;
-                }
-            } catch (const std::runtime_error&) {
-                // Resource not initialized, treat as no change
-                changed = false;
+                changed = changed || alwaysChanged;
             }
         } // Lock is automatically released here
 
+        if (changed) {
+            this->recordSourceChange();
+            publishChange(*this);
+        }
+
         // Trigger notifications like ReactImpl does
         if (!g_batch_execute && changed) {
             this->notify(true);
@@ -289,12 +315,12 @@ private:
      */
     template<typename T>
     void initializeWith(T&& t) {
-        try {
+        REACTION_TRY {
             initializeWithImpl(std::forward<T>(t));
-        } catch (...) {
+        } REACTION_CATCH(...) {
             is_initialized = false;
             is_sbo_storage = false;
-            throw;
+            REACTION_RETHROW;
         }
     }
 
@@ -377,7 +403,7 @@ private:
     }
 
 protected:
-    mutable ConditionalSharedMutex m_resourceMutex; ///< Thread-safe access mutex
+    mutable ConditionalSharedMutex m_resourceMutex{LockClass::RESOURCE}; ///< Thread-safe access mutex
 };
 
 } // namespace reaction::memory
\ No newline at end of file
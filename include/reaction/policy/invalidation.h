@@ -8,6 +8,7 @@
 #pragma once
 
 #include "reaction/core/concept.h"
+#include "reaction/core/exception.h"
 
 namespace reaction {
 
@@ -63,10 +64,10 @@ struct LastHandle : InvalidationBase<LastHandle> {
     template <typename Source>
     constexpr void handleInvalidImpl(Source &&source) {
         if constexpr (IsReactSource<std::remove_cvref_t<Source>>) {
-            try {
+            REACTION_TRY {
                 auto val = source.get();
                 source.set([val = std::move(val)]() noexcept { return val; });
-            } catch (...) {
+            } REACTION_CATCH(...) {
                 // If getting the value fails, fall back to close strategy
                 source.close();
             }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 
 namespace reaction {
@@ -66,6 +67,92 @@ private:
     std::atomic<bool> m_changed{true}; ///< Atomic flag indicating whether a change occurred.
 };
 
+/**
+ * @brief Change trigger that switches each node between eager and lazy evaluation.
+ *
+ * An eager node recomputes as soon as an input changes; a lazy node only
+ * marks itself dirty, notifies its observers and recomputes on the next read.
+ * The policy counts the upstream updates and reads of its node and picks the
+ * cheaper mode per window of WINDOW events:
+ * - it turns lazy when updates outnumber reads by more than LAZY_RATIO,
+ *   i.e. most results would be thrown away unread;
+ * - it turns eager again once updates drop to EAGER_RATIO times the reads.
+ * The gap between the two ratios is the hysteresis that keeps a node with a
+ * borderline ratio from flapping between the modes.
+ *
+ * A lazy node cannot tell whether its value changed, so its observers are
+ * always notified and re-read it. Actions have no readers and stay eager.
+ */
+struct AdaptiveTrig : ChangeTrig {
+public:
+    static constexpr uint32_t WINDOW = 64;     ///< Events per adaptation window.
+    static constexpr uint32_t LAZY_RATIO = 4;  ///< Updates per read above which the node turns lazy.
+    static constexpr uint32_t EAGER_RATIO = 2; ///< Updates per read at or below which it turns eager.
+
+    /// @brief Whether the node currently defers recomputation to reads.
+    [[nodiscard]] bool isLazy() const noexcept {
+        return m_lazy.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Count an upstream update and decide how to handle it.
+     * @return true if the node is lazy and was marked dirty, false to recompute now.
+     */
+    bool deferUpdate() noexcept {
+        m_updates.fetch_add(1, std::memory_order_relaxed);
+        adapt();
+        if (m_lazy.load(std::memory_order_relaxed)) {
+            m_dirtyGeneration.fetch_add(1, std::memory_order_acq_rel);
+            return true;
+        }
+        // The eager recomputation also settles updates deferred before the switch
+        markClean(dirtyGeneration());
+        return false;
+    }
+
+    /// @brief Count a read of the node.
+    void recordRead() const noexcept {
+        m_reads.fetch_add(1, std::memory_order_relaxed);
+        adapt();
+    }
+
+    /// @brief Number of updates deferred so far.
+    [[nodiscard]] uint64_t dirtyGeneration() const noexcept {
+        return m_dirtyGeneration.load(std::memory_order_acquire);
+    }
+
+    /// @brief Whether deferred updates are not yet reflected in the value.
+    [[nodiscard]] bool isDirty() const noexcept {
+        return m_cleanGeneration.load(std::memory_order_acquire) != dirtyGeneration();
+    }
+
+    /// @brief Record that the value reflects all updates up to a generation.
+    void markClean(uint64_t generation) const noexcept {
+        m_cleanGeneration.store(generation, std::memory_order_release);
+    }
+
+private:
+    void adapt() const noexcept {
+        const uint32_t updates = m_updates.load(std::memory_order_relaxed);
+        const uint32_t reads = m_reads.load(std::memory_order_relaxed);
+        if (updates + reads < WINDOW) return;
+        // Concurrent events may slip past the reset; the next window absorbs them
+        m_updates.store(0, std::memory_order_relaxed);
+        m_reads.store(0, std::memory_order_relaxed);
+        if (updates > LAZY_RATIO * reads) {
+            m_lazy.store(true, std::memory_order_relaxed);
+        } else if (updates <= EAGER_RATIO * reads) {
+            m_lazy.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    mutable std::atomic<uint32_t> m_updates{0}; ///< Upstream updates in the current window.
+    mutable std::atomic<uint32_t> m_reads{0};   ///< Reads in the current window.
+    mutable std::atomic<bool> m_lazy{false};    ///< Current evaluation mode.
+    std::atomic<uint64_t> m_dirtyGeneration{0};         ///< Updates deferred by the lazy mode.
+    mutable std::atomic<uint64_t> m_cleanGeneration{0}; ///< Deferred updates reflected in the value.
+};
+
 /**
  * @brief Trigger policy that uses a user-provided filter function.
  *
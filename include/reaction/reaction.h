@@ -30,16 +30,26 @@
 // Thread safety management
 #include "reaction/concurrency/thread_manager.h"
 
+// Broadcast ring buffer for change events
+#include "reaction/concurrency/change_event_ring.h"
+
+// NUMA topology and partition-owning worker pool
+#include "reaction/concurrency/numa.h"
+
 // Core reactive node and resource management
 #include "reaction/core/observer_node.h"
 #include "reaction/core/react.h"
 #include "reaction/core/resource.h"
 
+// Per-node value history for time-travel reads
+#include "reaction/core/value_history.h"
+
 // === Graph Management ===
 
 // Observer and dependency graph management
 #include "reaction/graph/field_graph.h"
 #include "reaction/graph/observer_graph.h"
+#include "reaction/graph/compact_topology.h"
 
 // === Expression System ===
 
@@ -51,6 +61,20 @@
 // Batch processing for performance optimization
 #include "reaction/graph/batch.h"
 
+// Time-sliced propagation for bounded write latency
+#include "reaction/graph/propagation_scheduler.h"
+
+// Epoch-stamped change feed for polling consumers
+#include "reaction/graph/change_feed.h"
+
+// Historical replay from memory-mapped columnar files
+#include "reaction/replay/replay_driver.h"
+#include "reaction/memory/alloc_tracking.h"
+#include "reaction/memory/mapped_var.h"
+#include "reaction/ipc/shared_memory.h"
+#include "reaction/ipc/transport.h"
+#include "reaction/ipc/remote_node.h"
+
 // === Policy Components ===
 
 // Invalidation strategies
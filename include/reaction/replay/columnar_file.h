@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/exception.h"
+#include "reaction/memory/mapped_file.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Element types a columnar time-series file can store.
+ */
+enum class ColumnType : uint32_t {
+    INT32 = 1,
+    INT64,
+    UINT32,
+    UINT64,
+    FLOAT32,
+    FLOAT64,
+};
+
+/**
+ * @brief Checks whether T can be stored as a column.
+ */
+template <typename T>
+concept ColumnValue = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> ||
+                      std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t> ||
+                      std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/**
+ * @brief Map a column value type to its on-disk tag.
+ */
+template <ColumnValue T>
+constexpr ColumnType columnTypeOf() noexcept {
+    if constexpr (std::is_same_v<T, int32_t>) return ColumnType::INT32;
+    else if constexpr (std::is_same_v<T, int64_t>) return ColumnType::INT64;
+    else if constexpr (std::is_same_v<T, uint32_t>) return ColumnType::UINT32;
+    else if constexpr (std::is_same_v<T, uint64_t>) return ColumnType::UINT64;
+    else if constexpr (std::is_same_v<T, float>) return ColumnType::FLOAT32;
+    else return ColumnType::FLOAT64;
+}
+
+/**
+ * @brief On-disk layout of a columnar time-series file.
+ *
+ * A fixed header is followed by one descriptor per column and then by the
+ * column data, each column stored contiguously and 64-byte aligned so it can
+ * be read in place from a memory mapping. Integers use the host byte order.
+ */
+namespace columnar {
+
+inline constexpr std::array<char, 8> MAGIC{'R', 'X', 'C', 'O', 'L', 'v', '1', '\0'};
+inline constexpr size_t NAME_SIZE = 48;
+inline constexpr size_t ALIGNMENT = 64;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint64_t rowCount;
+    uint32_t columnCount;
+    uint32_t reserved;
+};
+
+struct ColumnDescriptor {
+    std::array<char, NAME_SIZE> name;
+    ColumnType type;
+    uint32_t elementSize;
+    uint64_t offset;
+};
+
+} // namespace columnar
+
+/**
+ * @brief Memory-mapped reader for columnar time-series files.
+ *
+ * Columns are exposed as spans directly over the mapping, so opening a file
+ * costs only the header parse and rows are paged in as they are read.
+ */
+class ColumnarFile {
+public:
+    /**
+     * @brief Description of one column.
+     */
+    struct ColumnInfo {
+        std::string name;   ///< Column name.
+        ColumnType type;    ///< Element type.
+        uint64_t offset;    ///< Byte offset of the first element.
+    };
+
+    /**
+     * @brief Open and validate a columnar file.
+     * @param path Path of the file.
+     * @throws InvalidStateException if the file is missing, truncated or not a columnar file.
+     */
+    explicit ColumnarFile(const std::string &path) : m_file(path) {
+        columnar::FileHeader header{};
+        if (m_file.size() < sizeof(header)) {
+            REACTION_THROW_INVALID_STATE("'" + path + "' is truncated", "columnar file");
+        }
+        std::memcpy(&header, m_file.data(), sizeof(header));
+        if (header.magic != columnar::MAGIC) {
+            REACTION_THROW_INVALID_STATE("'" + path + "' has no columnar header", "columnar file");
+        }
+        const size_t tableEnd = sizeof(header) + header.columnCount * sizeof(columnar::ColumnDescriptor);
+        if (m_file.size() < tableEnd) {
+            REACTION_THROW_INVALID_STATE("'" + path + "' is truncated", "columnar file");
+        }
+
+        m_rows = header.rowCount;
+        m_columns.reserve(header.columnCount);
+        for (uint32_t i = 0; i < header.columnCount; ++i) {
+            columnar::ColumnDescriptor desc{};
+            std::memcpy(&desc, m_file.data() + sizeof(header) + i * sizeof(desc), sizeof(desc));
+            if (desc.offset + m_rows * desc.elementSize > m_file.size()) {
+                REACTION_THROW_INVALID_STATE("'" + path + "' is truncated", "columnar file");
+            }
+            auto nameEnd = std::find(desc.name.begin(), desc.name.end(), '\0');
+            m_columns.push_back({std::string(desc.name.begin(), nameEnd), desc.type, desc.offset});
+        }
+    }
+
+    /// @brief Number of rows (ticks) in the file.
+    [[nodiscard]] size_t rows() const noexcept {
+        return m_rows;
+    }
+
+    /// @brief Descriptions of all columns, in file order.
+    [[nodiscard]] const std::vector<ColumnInfo> &columns() const noexcept {
+        return m_columns;
+    }
+
+    /// @brief Whether a column with the given name exists.
+    [[nodiscard]] bool hasColumn(std::string_view name) const noexcept {
+        return find(name) != nullptr;
+    }
+
+    /**
+     * @brief Get a column as a typed span over the mapping.
+     *
+     * @tparam T Element type the column was written with.
+     * @param name Column name.
+     * @return std::span<const T> All rows of the column.
+     * @throws InvalidStateException if the column does not exist.
+     * @throws TypeMismatchException if the column holds a different type.
+     */
+    template <ColumnValue T>
+    [[nodiscard]] std::span<const T> column(std::string_view name) const {
+        const ColumnInfo *info = find(name);
+        if (!info) {
+            REACTION_THROW_INVALID_STATE("column '" + std::string(name) + "' missing", "existing column");
+        }
+        if (info->type != columnTypeOf<T>()) {
+            REACTION_THROW_TYPE_MISMATCH(std::to_string(static_cast<uint32_t>(columnTypeOf<T>())),
+                std::to_string(static_cast<uint32_t>(info->type)));
+        }
+        return {reinterpret_cast<const T *>(m_file.data() + info->offset), m_rows};
+    }
+
+private:
+    [[nodiscard]] const ColumnInfo *find(std::string_view name) const noexcept {
+        auto it = std::find_if(m_columns.begin(), m_columns.end(), [&](const ColumnInfo &c) { return c.name == name; });
+        return it == m_columns.end() ? nullptr : &*it;
+    }
+
+    memory::MappedFile m_file;         ///< Mapping of the whole file.
+    size_t m_rows{0};                  ///< Number of rows.
+    std::vector<ColumnInfo> m_columns; ///< Parsed column table.
+};
+
+/**
+ * @brief Builder for columnar time-series files.
+ *
+ * Used to convert recorded data into the replay format; all columns must
+ * have the same number of rows.
+ */
+class ColumnarWriter {
+public:
+    /**
+     * @brief Add a column.
+     *
+     * @tparam T Element type.
+     * @param name Column name, at most columnar::NAME_SIZE - 1 characters.
+     * @param values Rows of the column.
+     * @return ColumnarWriter& This writer, for chaining.
+     * @throws InvalidStateException if the name is too long or the row count differs.
+     */
+    template <ColumnValue T>
+    ColumnarWriter &addColumn(std::string_view name, std::span<const T> values) {
+        if (name.size() >= columnar::NAME_SIZE) {
+            REACTION_THROW_INVALID_STATE("column name '" + std::string(name) + "' too long", "shorter name");
+        }
+        if (!m_columns.empty() && values.size() != m_rows) {
+            REACTION_THROW_INVALID_STATE("column '" + std::string(name) + "' has a different row count", "equal row counts");
+        }
+        m_rows = values.size();
+
+        Column column{std::string(name), columnTypeOf<T>(), sizeof(T), {}};
+        column.bytes.resize(values.size_bytes());
+        std::memcpy(column.bytes.data(), values.data(), values.size_bytes());
+        m_columns.push_back(std::move(column));
+        return *this;
+    }
+
+    /// @brief Add a column from a vector.
+    template <ColumnValue T>
+    ColumnarWriter &addColumn(std::string_view name, const std::vector<T> &values) {
+        return addColumn(name, std::span<const T>(values));
+    }
+
+    /**
+     * @brief Write the file.
+     * @param path Destination path, overwritten if it exists.
+     * @throws InvalidStateException if the file cannot be written.
+     */
+    void write(const std::string &path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            REACTION_THROW_INVALID_STATE("cannot write '" + path + "'", "writable file");
+        }
+
+        columnar::FileHeader header{columnar::MAGIC, m_rows, static_cast<uint32_t>(m_columns.size()), 0};
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+        uint64_t offset = alignUp(sizeof(header) + m_columns.size() * sizeof(columnar::ColumnDescriptor));
+        std::vector<uint64_t> offsets;
+        for (const auto &column : m_columns) {
+            columnar::ColumnDescriptor desc{};
+            std::copy(column.name.begin(), column.name.end(), desc.name.begin());
+            desc.type = column.type;
+            desc.elementSize = column.elementSize;
+            desc.offset = offset;
+            offsets.push_back(offset);
+            out.write(reinterpret_cast<const char *>(&desc), sizeof(desc));
+            offset = alignUp(offset + column.bytes.size());
+        }
+
+        const std::array<char, columnar::ALIGNMENT> padding{};
+        for (size_t i = 0; i < m_columns.size(); ++i) {
+            out.write(padding.data(), static_cast<std::streamsize>(offsets[i] - static_cast<uint64_t>(out.tellp())));
+            out.write(reinterpret_cast<const char *>(m_columns[i].bytes.data()), static_cast<std::streamsize>(m_columns[i].bytes.size()));
+        }
+        if (!out) {
+            REACTION_THROW_INVALID_STATE("cannot write '" + path + "'", "writable file");
+        }
+    }
+
+private:
+    struct Column {
+        std::string name;
+        ColumnType type;
+        uint32_t elementSize;
+        std::vector<std::byte> bytes;
+    };
+
+    static uint64_t alignUp(uint64_t offset) noexcept {
+        return (offset + columnar::ALIGNMENT - 1) / columnar::ALIGNMENT * columnar::ALIGNMENT;
+    }
+
+    std::vector<Column> m_columns; ///< Columns added so far.
+    size_t m_rows{0};              ///< Common row count.
+};
+
+} // namespace reaction
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#pragma once
+
+#include "reaction/core/react.h"
+#include "reaction/graph/batch.h"
+#include "reaction/replay/columnar_file.h"
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace reaction {
+
+/**
+ * @brief Range and per-tick hook of a replay run.
+ */
+struct ReplayOptions {
+    size_t firstRow = 0;                                  ///< First row to replay.
+    size_t rowCount = std::numeric_limits<size_t>::max(); ///< Maximum number of rows to replay.
+    std::function<void(size_t)> onTick = nullptr;         ///< Called with the row index after each tick has propagated.
+};
+
+/**
+ * @brief Throughput report of a replay run.
+ */
+struct ReplayStats {
+    size_t ticks = 0;                       ///< Number of rows replayed.
+    std::chrono::nanoseconds elapsed{0};    ///< Wall-clock time of the run.
+
+    /// @brief Replayed rows per second.
+    [[nodiscard]] double ticksPerSecond() const noexcept {
+        return elapsed.count() > 0 ? static_cast<double>(ticks) * 1e9 / static_cast<double>(elapsed.count()) : 0.0;
+    }
+};
+
+/**
+ * @brief Drives an unchanged live graph from a columnar historical file.
+ *
+ * Each column is bound to a source Var once; every row of the file is then
+ * one tick that writes all bound Vars and propagates the change exactly like
+ * a live batch update, so downstream calcs and actions see every tick.
+ *
+ * The per-tick path is kept minimal: columns are resolved to typed spans over
+ * the memory mapping at bind time (no name lookups), and all writes run
+ * through one Batch whose affected nodes are collected and depth-ordered once
+ * for the whole run (no per-write notification). Replaying from a single
+ * thread keeps the graph's conditional locks disabled.
+ */
+class ReplayDriver {
+public:
+    /**
+     * @brief Create a driver reading from the given file.
+     * @param file Columnar input; must outlive the driver.
+     */
+    explicit ReplayDriver(const ColumnarFile &file) : m_file(file) {}
+
+    ReplayDriver(const ReplayDriver &) = delete;
+    ReplayDriver &operator=(const ReplayDriver &) = delete;
+
+    /**
+     * @brief Bind a column to a source Var.
+     *
+     * @param column Column name in the file.
+     * @param var Var receiving the column values; its type must match the column.
+     * @return ReplayDriver& This driver, for chaining.
+     * @throws InvalidStateException if the column does not exist.
+     * @throws TypeMismatchException if the column holds a different type.
+     */
+    template <ColumnValue T, IsInvalidation IV, IsTrigger TR>
+    ReplayDriver &bind(std::string_view column, React<VarExpr, T, IV, TR> var) {
+        std::span<const T> values = m_file.column<T>(column);
+        m_writers.push_back([values, var = std::move(var)](size_t row) mutable {
+            var.value(values[row]);
+        });
+        m_batch.reset();
+        return *this;
+    }
+
+    /**
+     * @brief Replay rows through the graph.
+     *
+     * @param options Row range and per-tick hook.
+     * @return ReplayStats Number of ticks replayed and the time taken.
+     */
+    ReplayStats run(const ReplayOptions &options = {}) {
+        ReplayStats stats;
+        if (m_writers.empty() || options.firstRow >= m_file.rows()) return stats;
+
+        const size_t last = options.firstRow + std::min(options.rowCount, m_file.rows() - options.firstRow);
+        if (!m_batch) {
+            m_batch = std::make_unique<Batch>([this]() {
+                for (auto &writer : m_writers) {
+                    writer(m_row);
+                }
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (m_row = options.firstRow; m_row < last; ++m_row) {
+            m_batch->execute();
+            if (options.onTick) {
+                options.onTick(m_row);
+            }
+        }
+        stats.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        stats.ticks = last - options.firstRow;
+        return stats;
+    }
+
+private:
+    const ColumnarFile &m_file;                        ///< Input file.
+    std::vector<std::function<void(size_t)>> m_writers; ///< One writer per bound column.
+    std::unique_ptr<Batch> m_batch;                    ///< Pre-collected batch reused for every tick.
+    size_t m_row{0};                                   ///< Row being replayed.
+};
+
+} // namespace reaction
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+
+// Allocations count towards the innermost scope, which is restored on exit
+TEST(AllocTrackingTest, NestedScopes) {
+    using reaction::AllocScope;
+    using reaction::AllocSubsystem;
+    using reaction::AllocTracker;
+    auto &tracker = AllocTracker::getInstance();
+    tracker.reset();
+
+    {
+        AllocScope write(AllocSubsystem::WRITE);
+        tracker.record(16);
+        {
+            AllocScope notify(AllocSubsystem::NOTIFY);
+            tracker.record(32);
+        }
+        tracker.record(8);
+    }
+    tracker.record(4);
+    EXPECT_EQ(AllocTracker::current(), AllocSubsystem::OTHER);
+
+    if constexpr (AllocTracker::ENABLED) {
+        EXPECT_EQ(tracker.snapshot(AllocSubsystem::WRITE).allocations, 2u);
+        EXPECT_EQ(tracker.snapshot(AllocSubsystem::WRITE).bytes, 24u);
+        EXPECT_EQ(tracker.snapshot(AllocSubsystem::NOTIFY).bytes, 32u);
+        EXPECT_EQ(tracker.snapshot(AllocSubsystem::OTHER).bytes, 4u);
+    } else {
+        EXPECT_EQ(tracker.snapshot(AllocSubsystem::OTHER).allocations, 4u);
+    }
+    EXPECT_EQ(tracker.total().allocations, 4u);
+    EXPECT_EQ(tracker.total().bytes, 60u);
+
+    tracker.record(AllocSubsystem::BATCH, 100);
+    EXPECT_EQ(tracker.snapshot(AllocSubsystem::BATCH).bytes, 100u);
+    tracker.reset();
+    EXPECT_EQ(tracker.total().allocations, 0u);
+}
+
+// Framework operations tag the calling thread while they run
+TEST(AllocTrackingTest, OperationsTagAllocations) {
+    using reaction::AllocSubsystem;
+    using reaction::AllocTracker;
+
+    AllocSubsystem seen = AllocSubsystem::OTHER;
+    auto a = reaction::var(1);
+    auto b = reaction::calc([&]() {
+        seen = AllocTracker::current();
+        return a() + 1;
+    });
+    EXPECT_EQ(seen, AllocTracker::ENABLED ? AllocSubsystem::CREATION : AllocSubsystem::OTHER);
+
+    a.value(2);
+    EXPECT_EQ(seen, AllocTracker::ENABLED ? AllocSubsystem::WRITE : AllocSubsystem::OTHER);
+
+    reaction::batchExecute([&]() { a.value(3); });
+    EXPECT_EQ(seen, AllocTracker::ENABLED ? AllocSubsystem::BATCH : AllocSubsystem::OTHER);
+    EXPECT_EQ(b.get(), 4);
+    EXPECT_EQ(AllocTracker::current(), AllocSubsystem::OTHER);
+}
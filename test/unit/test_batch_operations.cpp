@@ -583,4 +583,29 @@ TEST(BatchOperationsTest, TestMultipleBatchesWithSharedDependencies) {
     EXPECT_EQ(triggerCountA, 1); // obs4 recalculated (a and obs3 changed)
     EXPECT_EQ(triggerCountB, 1); // obs5 recalculated (obs4 changed)
     EXPECT_EQ(triggerCountC, 1); // obs6 recalculated (c, obs5, and obs3 changed)
-}
\ No newline at end of file
+}
+/**
+ * @brief Test that protection is counted per node across overlapping batches
+ */
+TEST(BatchOperationsTest, TestOverlappingBatchProtection) {
+    auto var1 = reaction::var(1);
+    auto var2 = reaction::var(2);
+    auto calc1 = reaction::calc([&]() { return var1() + var2(); });
+    auto calc2 = reaction::calc([&]() { return var2() * 2; });
+
+    auto batch1 = reaction::batch([&]() { var1.value(10); });
+    {
+        auto batch2 = reaction::batch([&]() { var2.value(20); });
+        EXPECT_THROW(calc1.reset([&]() { return var1() * 3; }), reaction::BatchOperationConflictException);
+        EXPECT_THROW(calc2.reset([&]() { return var2() * 3; }), reaction::BatchOperationConflictException);
+    }
+
+    // batch2 is gone: calc2 is free again, calc1 is still held by batch1
+    EXPECT_NO_THROW(calc2.reset([&]() { return var2() * 3; }));
+    EXPECT_THROW(calc1.reset([&]() { return var1() * 3; }), reaction::BatchOperationConflictException);
+
+    batch1.close();
+    EXPECT_NO_THROW(calc1.reset([&]() { return var1() * 3; }));
+    EXPECT_EQ(calc1.get(), 3);
+    EXPECT_EQ(calc2.get(), 6);
+}
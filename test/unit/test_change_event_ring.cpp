@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <thread>
+
+using PollStatus = reaction::ChangeEventRing::PollStatus;
+
+// Test that var writes and calc recomputations publish events to every consumer
+TEST(ChangeEventRingTest, TestBroadcastToConsumers) {
+    reaction::ChangeEventRing ring(16);
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int aa) { return aa * 2.5; }, a);
+
+    ring.attach();
+    auto first = ring.subscribe();
+    auto second = ring.subscribe();
+    a.value(4);
+    a.value(4); // unchanged, no event
+    ring.detach();
+    a.value(5); // detached, no event
+
+    for (auto *cursor : {&first, &second}) {
+        reaction::ChangeEvent event;
+        ASSERT_EQ(cursor->poll(event), PollStatus::OK);
+        EXPECT_EQ(event.nodeId, a.getId());
+        EXPECT_EQ(event.as<int>(), 4);
+        EXPECT_EQ(event.epoch, a.getChangeEpoch() - 1);
+
+        ASSERT_EQ(cursor->poll(event), PollStatus::OK);
+        EXPECT_EQ(event.nodeId, b.getId());
+        EXPECT_DOUBLE_EQ(event.as<double>(), 10.0);
+
+        EXPECT_EQ(cursor->poll(event), PollStatus::EMPTY);
+    }
+}
+
+// Test that a lagging consumer is resynchronized instead of blocking the producer
+TEST(ChangeEventRingTest, TestOverrun) {
+    reaction::ChangeEventRing ring(4);
+    auto cursor = ring.subscribe();
+    for (int i = 1; i <= 10; ++i) {
+        EXPECT_TRUE(ring.publish(1, i, &i, sizeof(i)));
+    }
+
+    reaction::ChangeEvent event;
+    EXPECT_EQ(cursor.poll(event), PollStatus::OVERRUN);
+    EXPECT_EQ(cursor.missed(), 7u);
+
+    std::vector<int> seen;
+    while (cursor.poll(event) == PollStatus::OK) {
+        seen.push_back(event.as<int>());
+    }
+    EXPECT_EQ(seen, (std::vector<int>{8, 9, 10}));
+}
+
+// Test that oversized payloads are rejected
+TEST(ChangeEventRingTest, TestOversizedPayload) {
+    reaction::ChangeEventRing ring(4);
+    std::array<char, reaction::ChangeEvent::MAX_PAYLOAD + 1> big{};
+    EXPECT_FALSE(ring.publish(1, 1, big.data(), big.size()));
+    EXPECT_EQ(ring.published(), 0u);
+}
+
+// Test concurrent consumers reading while the producer publishes
+TEST(ChangeEventRingTest, TestConcurrentConsumers) {
+    constexpr int EVENTS = 20000;
+    reaction::ChangeEventRing ring(1024);
+
+    auto consume = [&ring](reaction::ChangeEventRing::Cursor cursor, int &last, bool &ordered) {
+        reaction::ChangeEvent event;
+        while (last < EVENTS) {
+            if (cursor.poll(event) == PollStatus::OK) {
+                int value = event.as<int>();
+                ordered = ordered && value > last && event.epoch == static_cast<uint64_t>(value);
+                last = value;
+            }
+        }
+    };
+
+    int lastA = 0, lastB = 0;
+    bool orderedA = true, orderedB = true;
+    std::thread consumerA(consume, ring.subscribe(), std::ref(lastA), std::ref(orderedA));
+    std::thread consumerB(consume, ring.subscribe(), std::ref(lastB), std::ref(orderedB));
+
+    for (int i = 1; i <= EVENTS; ++i) {
+        ring.publish(7, i, &i, sizeof(i));
+    }
+    consumerA.join();
+    consumerB.join();
+
+    EXPECT_TRUE(orderedA);
+    EXPECT_TRUE(orderedB);
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <algorithm>
+
+// Test that writes stamp the written node and its changed observers
+TEST(ChangeFeedTest, TestEpochStamping) {
+    auto &feed = reaction::ChangeFeed::getInstance();
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    auto sum = reaction::calc([](int aa, int bb) { return aa + bb; }, a, b);
+    auto parity = reaction::calc([](int s) { return s % 2; }, sum);
+
+    uint64_t epoch = feed.now();
+    a.value(3);
+
+    EXPECT_TRUE(a.changedSince(epoch));
+    EXPECT_TRUE(sum.changedSince(epoch));
+    EXPECT_FALSE(b.changedSince(epoch));
+    EXPECT_FALSE(parity.changedSince(epoch));
+    EXPECT_EQ(a.getChangeEpoch(), sum.getChangeEpoch());
+
+    // Writing the same value is not a change
+    epoch = feed.now();
+    a.value(3);
+    EXPECT_FALSE(a.changedSince(epoch));
+    EXPECT_FALSE(sum.changedSince(epoch));
+}
+
+// Test that a batch execution shares a single epoch
+TEST(ChangeFeedTest, TestBatchSharesEpoch) {
+    auto &feed = reaction::ChangeFeed::getInstance();
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    auto sum = reaction::calc([](int aa, int bb) { return aa + bb; }, a, b);
+
+    uint64_t epoch = feed.now();
+    reaction::batchExecute([&]() {
+        a.value(10);
+        b.value(20);
+    });
+
+    EXPECT_EQ(feed.now(), epoch + 1);
+    EXPECT_EQ(a.getChangeEpoch(), epoch + 1);
+    EXPECT_EQ(b.getChangeEpoch(), epoch + 1);
+    EXPECT_EQ(sum.getChangeEpoch(), epoch + 1);
+}
+
+// Test named-node queries
+TEST(ChangeFeedTest, TestChangedNamesSince) {
+    auto &feed = reaction::ChangeFeed::getInstance();
+    auto a = reaction::var(1).setName("feed_a");
+    auto b = reaction::var(1).setName("feed_b");
+    auto c = reaction::calc([](int aa) { return aa * 2; }, a).setName("feed_c");
+
+    uint64_t epoch = feed.now();
+    a.value(5);
+
+    auto names = feed.changedNamesSince(epoch);
+    EXPECT_NE(std::find(names.begin(), names.end(), "feed_a"), names.end());
+    EXPECT_NE(std::find(names.begin(), names.end(), "feed_c"), names.end());
+    EXPECT_EQ(std::find(names.begin(), names.end(), "feed_b"), names.end());
+}
+
+// Test log-backed global queries, including fallback once the log has wrapped
+TEST(ChangeFeedTest, TestDirtyLog) {
+    auto &feed = reaction::ChangeFeed::getInstance();
+    feed.enableLog(4);
+
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int aa) { return aa + 1; }, a);
+    auto other = reaction::var(0);
+
+    uint64_t epoch = feed.now();
+    a.value(2);
+    auto changed = feed.changedSince(epoch);
+    EXPECT_EQ(changed.size(), 2u);
+
+    // Overflow the log; the query still sees every change through the graph scan
+    for (int i = 1; i <= 5; ++i) {
+        other.value(i);
+    }
+    changed = feed.changedSince(epoch);
+    EXPECT_EQ(changed.size(), 3u);
+
+    feed.disableLog();
+    changed = feed.changedSince(epoch);
+    EXPECT_EQ(changed.size(), 3u);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+// Closing a node closes everything downstream and leaves upstream intact
+TEST(CloseManyTest, CloseCascadesDownstream) {
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    auto c = reaction::calc([](int x) { return x * 2; }, b);
+    auto d = reaction::calc([](int x) { return x * 3; }, a);
+
+    b.close();
+    EXPECT_FALSE(static_cast<bool>(b));
+    EXPECT_FALSE(static_cast<bool>(c));
+    EXPECT_TRUE(static_cast<bool>(a));
+    EXPECT_TRUE(static_cast<bool>(d));
+
+    // The surviving dependency no longer notifies the closed nodes
+    a.value(2);
+    EXPECT_EQ(d.get(), 6);
+}
+
+// A long chain is closed iteratively
+TEST(CloseManyTest, CloseDeepChain) {
+    auto root = reaction::var(0);
+    using Handle = decltype(reaction::calc([](int x) { return x; }, root));
+    std::vector<Handle> chain;
+    chain.push_back(reaction::calc([](int x) { return x + 1; }, root));
+    for (int i = 1; i < 2000; ++i) {
+        chain.push_back(reaction::calc([](int x) { return x + 1; }, chain.back()));
+    }
+    EXPECT_EQ(chain.back().get(), 2000);
+
+    chain.front().close();
+    EXPECT_FALSE(static_cast<bool>(chain.back()));
+    EXPECT_TRUE(static_cast<bool>(root));
+}
+
+// Several roots with shared dependents are closed in one operation
+TEST(CloseManyTest, CloseManyWithSharedDependents) {
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    auto keep = reaction::var(3);
+    auto sum = reaction::calc([](int x, int y) { return x + y; }, a, b);
+    auto total = reaction::calc([](int x, int y) { return x + y; }, sum, keep);
+    auto other = reaction::calc([](int x) { return x; }, keep);
+
+    reaction::closeMany(a, b);
+    EXPECT_FALSE(static_cast<bool>(a));
+    EXPECT_FALSE(static_cast<bool>(b));
+    EXPECT_FALSE(static_cast<bool>(sum));
+    EXPECT_FALSE(static_cast<bool>(total));
+    EXPECT_TRUE(static_cast<bool>(keep));
+
+    keep.value(4);
+    EXPECT_EQ(other.get(), 4);
+
+    // Already closed handles are skipped
+    EXPECT_NO_THROW(reaction::closeMany(a, sum, other));
+    EXPECT_FALSE(static_cast<bool>(other));
+}
+
+// Node destructors run after the graph lock is released and may use the graph
+TEST(CloseManyTest, ReclamationOutsideGraphLock) {
+    auto a = reaction::var(1);
+    std::thread([] {}).join(); // enable conditional locking
+
+    // The calc owns the only handle to probe; reclaiming the calc releases it,
+    // and CloseHandle then closes probe, re-entering the graph
+    auto holder = reaction::calc([probe = reaction::var<reaction::ChangeTrig, reaction::CloseHandle>(10)](int x) {
+        return x + probe();
+    }, a);
+    EXPECT_EQ(holder.get(), 11);
+    holder.close();
+    EXPECT_FALSE(static_cast<bool>(holder));
+
+    a.value(2);
+    EXPECT_EQ(a.get(), 2);
+}
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+// Propagation over the compact layout gives the same results as before
+TEST(CompactTopologyTest, SameResultsAfterCompact) {
+    auto run = [](bool compact) {
+        auto a = reaction::var(1);
+        auto b = reaction::var(2);
+        auto sum = reaction::calc([](int x, int y) { return x + y; }, a, b);
+        auto prod = reaction::calc([](int x, int y) { return x * y; }, a, b);
+        auto total = reaction::calc([](int x, int y) { return x + y; }, sum, prod);
+        std::vector<int> seen;
+        auto act = reaction::action([&seen](int x) { seen.push_back(x); }, total);
+
+        if (compact) {
+            EXPECT_GE(reaction::compact(), 6u);
+            EXPECT_NE(reaction::ObserverGraph::getInstance().compactTopology(), nullptr);
+        }
+        a.value(3);
+        EXPECT_EQ(total.get(), 11);
+        b.value(4);
+        EXPECT_EQ(total.get(), 19);
+        return seen;
+    };
+    EXPECT_EQ(run(true), run(false));
+}
+
+// Nodes are numbered so that every observer comes after what it observes
+TEST(CompactTopologyTest, TopologicalOrder) {
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    auto c = reaction::calc([](int x, int y) { return x + y; }, a, b);
+    auto d = reaction::calc([](int x) { return x * 2; }, c);
+
+    reaction::compact();
+    auto topology = reaction::ObserverGraph::getInstance().compactTopology();
+    ASSERT_NE(topology, nullptr);
+    for (uint32_t i = 0; i < topology->nodes.size(); ++i) {
+        for (uint32_t observer : topology->observersOf(i)) {
+            EXPECT_GT(observer, i);
+        }
+    }
+    EXPECT_EQ(d.get(), 6);
+}
+
+// Structure changes retire the snapshot and propagation falls back
+TEST(CompactTopologyTest, StructureChangeRetiresSnapshot) {
+    auto a = reaction::var(1);
+    auto b = reaction::var(10);
+    auto c = reaction::calc([](int x) { return x + 1; }, a);
+
+    reaction::compact();
+    ASSERT_NE(reaction::ObserverGraph::getInstance().compactTopology(), nullptr);
+
+    c.reset([&]() { return b() + 1; });
+    EXPECT_EQ(reaction::ObserverGraph::getInstance().compactTopology(), nullptr);
+    b.value(20);
+    EXPECT_EQ(c.get(), 21);
+    a.value(5);
+    EXPECT_EQ(c.get(), 21);
+
+    reaction::compact();
+    b.value(30);
+    EXPECT_EQ(c.get(), 31);
+
+    auto d = reaction::calc([](int x) { return x * 2; }, c);
+    EXPECT_EQ(reaction::ObserverGraph::getInstance().compactTopology(), nullptr);
+    b.value(40);
+    EXPECT_EQ(d.get(), 82);
+}
+
+// Closing nodes retires the snapshot, which then no longer keeps them alive
+TEST(CompactTopologyTest, CloseReleasesNodes) {
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    auto c = reaction::calc([](int x) { return x * 2; }, b);
+
+    reaction::compact();
+    b.close();
+    EXPECT_EQ(reaction::ObserverGraph::getInstance().compactTopology(), nullptr);
+    EXPECT_FALSE(static_cast<bool>(c));
+
+    a.value(2);
+    EXPECT_EQ(a.get(), 2);
+}
+
+// Propagation over the snapshot runs concurrently with compaction and edits
+TEST(CompactTopologyTest, ConcurrentCompact) {
+    reaction::ThreadManager::getInstance().enableThreadSafety();
+    auto a = reaction::var(0);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    auto c = reaction::calc([](int x) { return x * 2; }, b);
+
+    std::atomic<bool> done{false};
+    std::thread compactor([&]() {
+        while (!done.load()) {
+            reaction::compact();
+            auto extra = reaction::calc([](int x) { return x; }, b);
+            extra.close();
+        }
+    });
+    for (int i = 1; i <= 500; ++i) {
+        a.value(i);
+        EXPECT_EQ(c.get(), (i + 1) * 2);
+    }
+    done.store(true);
+    compactor.join();
+}
+
+// Marks are deduplicated, counted and visited in ascending order across words
+TEST(CompactTopologyTest, DirtyBitmap) {
+    reaction::DirtyBitmap dirty(10000);
+    EXPECT_TRUE(dirty.empty());
+    EXPECT_TRUE(dirty.set(4097));
+    EXPECT_TRUE(dirty.set(3));
+    EXPECT_TRUE(dirty.set(64));
+    EXPECT_FALSE(dirty.set(3));
+    EXPECT_EQ(dirty.count(), 3u);
+    EXPECT_TRUE(dirty.test(64));
+    EXPECT_FALSE(dirty.test(65));
+
+    std::vector<size_t> seen;
+    dirty.forEach([&](size_t index) { seen.push_back(index); });
+    EXPECT_EQ(seen, (std::vector<size_t>{3, 64, 4097}));
+
+    // Draining picks up marks made above the visited index
+    seen.clear();
+    dirty.drain([&](size_t index) {
+        seen.push_back(index);
+        if (index == 64) dirty.set(70);
+        if (index == 70) dirty.set(9999);
+    });
+    EXPECT_EQ(seen, (std::vector<size_t>{3, 64, 70, 4097, 9999}));
+    EXPECT_TRUE(dirty.empty());
+
+    dirty.set(5);
+    dirty.clear();
+    EXPECT_EQ(dirty.count(), 0u);
+}
+
+// Batches and rebind transactions walk the snapshot and recompute each node once
+TEST(CompactTopologyTest, BatchOverSnapshot) {
+    auto run = [](bool compact) {
+        auto a = reaction::var(1);
+        auto b = reaction::var(2);
+        int runs = 0;
+        auto sum = reaction::calc([&](int x, int y) { ++runs; return x + y; }, a, b);
+        auto prod = reaction::calc([&](int x, int y) { ++runs; return x * y; }, a, b);
+        auto total = reaction::calc([&](int x, int y) { ++runs; return x + y; }, sum, prod);
+        auto other = reaction::var(0);
+        auto unrelated = reaction::calc([&](int x) { ++runs; return x; }, other);
+        if (compact) {
+            reaction::compact();
+        }
+        runs = 0;
+        reaction::batchExecute([&]() {
+            a.value(3);
+            b.value(4);
+        });
+        EXPECT_EQ(runs, 3);
+        EXPECT_EQ(total.get(), 19);
+
+        runs = 0;
+        reaction::rebindAll([&]() { sum.reset([](int x, int y) { return x - y; }, a, b); });
+        EXPECT_EQ(total.get(), 11);
+        return runs;
+    };
+    EXPECT_EQ(run(true), run(false));
+}
+
+// A retired object outlives every reader pinned before it was retired
+TEST(CompactTopologyTest, EpochReclamation) {
+    auto &epochs = reaction::EpochManager::getInstance();
+    epochs.reclaim();
+    auto object = std::make_shared<int>(1);
+    std::weak_ptr<int> watch = object;
+    {
+        reaction::EpochGuard outer;
+        {
+            reaction::EpochGuard nested;
+        }
+        epochs.retire(std::move(object));
+        epochs.reclaim();
+        EXPECT_FALSE(watch.expired());
+    }
+    // Readers pinning after the retirement do not hold it back
+    reaction::EpochGuard later;
+    epochs.reclaim();
+    EXPECT_TRUE(watch.expired());
+    EXPECT_EQ(epochs.retiredCount(), 0u);
+}
+
+// With auto compaction, subscriptions, resets and closes republish the snapshot
+TEST(CompactTopologyTest, AutoCompact) {
+    struct AutoCompactScope {
+        AutoCompactScope() { reaction::autoCompact(); }
+        ~AutoCompactScope() { reaction::autoCompact(false); }
+    } scope;
+    auto &graph = reaction::ObserverGraph::getInstance();
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    ASSERT_TRUE(graph.hasCompactTopology());
+
+    auto c = reaction::calc([](int x) { return x * 10; }, b);
+    ASSERT_TRUE(graph.hasCompactTopology());
+    EXPECT_NE(graph.compactTopology()->nodes.size(), 0u);
+    a.value(2);
+    EXPECT_EQ(c.get(), 30);
+
+    c.reset([](int x) { return x * 100; }, a);
+    EXPECT_TRUE(graph.hasCompactTopology());
+    a.value(3);
+    EXPECT_EQ(c.get(), 300);
+
+    b.close();
+    EXPECT_TRUE(graph.hasCompactTopology());
+    a.value(4);
+    EXPECT_EQ(c.get(), 400);
+}
+
+// Ticking continues over published snapshots while another thread subscribes and unsubscribes
+TEST(CompactTopologyTest, SubscribeWhileTicking) {
+    reaction::ThreadManager::getInstance().enableThreadSafety();
+    struct AutoCompactScope {
+        AutoCompactScope() { reaction::autoCompact(); }
+        ~AutoCompactScope() { reaction::autoCompact(false); }
+    } scope;
+    auto a = reaction::var(0);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    auto c = reaction::calc([](int x) { return x * 2; }, b);
+
+    std::atomic<bool> done{false};
+    std::thread subscriber([&]() {
+        while (!done.load()) {
+            auto session = reaction::calc([](int x) { return x; }, b);
+            (void)session.get();
+            session.close();
+        }
+    });
+    for (int i = 1; i <= 500; ++i) {
+        a.value(i);
+        EXPECT_EQ(c.get(), (i + 1) * 2);
+    }
+    done.store(true);
+    subscriber.join();
+    reaction::EpochManager::getInstance().reclaim();
+    EXPECT_EQ(reaction::EpochManager::getInstance().retiredCount(), 0u);
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <cmath>
+
+using reaction::Error;
+using reaction::Expected;
+using ErrorCode = reaction::ReactionException::ErrorCode;
+
+namespace {
+Expected<double> safeSqrt(double x) {
+    if (x < 0) return Error{ErrorCode::INVALID_STATE, "negative input"};
+    return std::sqrt(x);
+}
+} // namespace
+
+// Test that errors propagate downstream as values and recover when the input does
+TEST(ExpectedTest, TestErrorPropagatesAsValue) {
+    auto input = reaction::var(16.0);
+    auto root = reaction::calc([](double x) { return safeSqrt(x); }, input);
+    auto scaled = reaction::calc([](double r) { return r * 10; }, root);
+    auto label = reaction::calc([](double s) { return static_cast<int>(s); }, scaled);
+
+    static_assert(std::is_same_v<decltype(scaled)::value_type, Expected<double>>);
+    static_assert(std::is_same_v<decltype(label)::value_type, Expected<int>>);
+    EXPECT_EQ(label.get().value(), 40);
+
+    input.value(-1.0);
+    ASSERT_FALSE(scaled.get().hasValue());
+    EXPECT_EQ(label.get().error().code, ErrorCode::INVALID_STATE);
+    EXPECT_STREQ(label.get().error().message, "negative input");
+
+    input.value(25.0);
+    EXPECT_DOUBLE_EQ(*scaled.get(), 50.0);
+    EXPECT_EQ(label.get().valueOr(0), 50);
+}
+
+// Test that actions are skipped while an input holds an error
+TEST(ExpectedTest, TestActionSkippedOnError) {
+    auto input = reaction::var(Expected<int>{1});
+    int runs = 0;
+    int last = 0;
+    auto act = reaction::action([&](int v) { ++runs; last = v; }, input);
+    EXPECT_EQ(runs, 1);
+
+    input.value(Error{ErrorCode::UNKNOWN, "feed down"});
+    EXPECT_EQ(runs, 1);
+
+    input.value(7);
+    EXPECT_EQ(runs, 2);
+    EXPECT_EQ(last, 7);
+}
+
+// Test that functions taking Expected arguments receive them unchanged
+TEST(ExpectedTest, TestExplicitHandling) {
+    auto input = reaction::var(Expected<int>{Error{ErrorCode::UNKNOWN, "bad"}});
+    auto fallback = reaction::calc([](const Expected<int> &v) { return v.valueOr(-1); }, input);
+    static_assert(std::is_same_v<decltype(fallback)::value_type, int>);
+    EXPECT_EQ(fallback.get(), -1);
+
+    input.value(3);
+    EXPECT_EQ(fallback.get(), 3);
+}
+
+// Test mixing plain and error-valued inputs, and that the first error wins
+TEST(ExpectedTest, TestMixedInputs) {
+    auto a = reaction::var(Expected<int>{2});
+    auto b = reaction::var(Expected<int>{3});
+    auto c = reaction::var(4);
+    auto sum = reaction::calc([](int x, int y, int z) { return x + y + z; }, a, b, c);
+    EXPECT_EQ(*sum.get(), 9);
+
+    reaction::batchExecute([&]() {
+        a.value(Error{ErrorCode::UNKNOWN, "a failed"});
+        b.value(Error{ErrorCode::UNKNOWN, "b failed"});
+    });
+    EXPECT_STREQ(sum.get().error().message, "a failed");
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory_resource>
+
+namespace {
+
+// Heap resource that counts outstanding allocations
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::atomic<size_t> allocations{0};
+    std::atomic<ptrdiff_t> outstanding{0};
+
+private:
+    void *do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        outstanding += static_cast<ptrdiff_t>(bytes);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+        outstanding -= static_cast<ptrdiff_t>(bytes);
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+};
+
+size_t liveNodes() {
+    size_t count = 0;
+    reaction::ObserverGraph::getInstance().forEachNode([&count](const reaction::NodePtr &) { ++count; });
+    return count;
+}
+
+// Puts the (emptied) graph back on the global heap
+struct DefaultMemoryGuard {
+    ~DefaultMemoryGuard() {
+        reaction::ObserverGraph::getInstance().useMemoryResource(std::pmr::new_delete_resource());
+    }
+};
+
+} // namespace
+
+// The resource can only be replaced while the graph is empty
+TEST(GraphMemoryTest, RequiresEmptyGraph) {
+    auto &graph = reaction::ObserverGraph::getInstance();
+    auto a = reaction::var(1);
+    EXPECT_THROW(graph.useMemoryResource(std::pmr::new_delete_resource()), reaction::InvalidStateException);
+    EXPECT_THROW(graph.useMemoryResource(nullptr), reaction::NullPointerAccessException);
+    EXPECT_EQ(graph.memoryResource(), std::pmr::new_delete_resource());
+    a.close();
+}
+
+// Graph maps, observer sets and caches allocate from the installed resource
+TEST(GraphMemoryTest, ContainersUseResource) {
+    if (liveNodes() != 0) GTEST_SKIP() << "graph not empty";
+    CountingResource counting;
+    {
+        auto &graph = reaction::ObserverGraph::getInstance();
+        graph.useMemoryResource(&counting);
+        DefaultMemoryGuard guard;
+        EXPECT_EQ(graph.memoryResource(), &counting);
+
+        auto a = reaction::var(1);
+        auto b = reaction::var(2);
+        auto sum = reaction::calc([](int x, int y) { return x + y; }, a, b);
+        auto twice = reaction::calc([](int x) { return x * 2; }, sum);
+        EXPECT_GT(counting.allocations.load(), 0u);
+
+        a.value(5);
+        EXPECT_EQ(twice.get(), 14);
+        reaction::closeMany(a, b);
+    }
+    // Everything was returned once the nodes were gone and the graph moved back
+    EXPECT_EQ(counting.outstanding.load(), 0);
+}
+
+// A graph-owned pool can be installed and replaced
+TEST(GraphMemoryTest, PooledMemory) {
+    if (liveNodes() != 0) GTEST_SKIP() << "graph not empty";
+    auto &graph = reaction::ObserverGraph::getInstance();
+    graph.usePooledMemory();
+    DefaultMemoryGuard guard;
+    EXPECT_NE(graph.memoryResource(), std::pmr::new_delete_resource());
+
+    {
+        using Handle = decltype(reaction::calc([](int x) { return x; }, std::declval<reaction::Var<int> &>()));
+        auto root = reaction::var(0);
+        std::vector<Handle> layer;
+        for (int i = 0; i < 100; ++i) {
+            layer.push_back(reaction::calc([i](int x) { return x + i; }, root));
+        }
+        root.value(10);
+        EXPECT_EQ(layer.back().get(), 109);
+        root.close();
+    }
+    graph.usePooledMemory(); // replaces and releases the first pool
+    auto a = reaction::var(3);
+    auto b = reaction::calc([](int x) { return x + 1; }, a);
+    EXPECT_EQ(b.get(), 4);
+    a.close();
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+// Durations land in power-of-two buckets and percentiles report bucket bounds
+TEST(LockStatsTest, Histogram) {
+    using reaction::LockHistogram;
+    EXPECT_EQ(LockHistogram::bucketOf(0), 0u);
+    EXPECT_EQ(LockHistogram::bucketOf(1), 0u);
+    EXPECT_EQ(LockHistogram::bucketOf(2), 1u);
+    EXPECT_EQ(LockHistogram::bucketOf(1000), 9u);
+    EXPECT_EQ(LockHistogram::bucketOf(UINT64_MAX), LockHistogram::BUCKETS - 1);
+
+    LockHistogram histogram;
+    EXPECT_EQ(histogram.percentile(0.5), 0u);
+    histogram.buckets[LockHistogram::bucketOf(100)] = 9;
+    histogram.buckets[LockHistogram::bucketOf(5000)] = 1;
+    EXPECT_EQ(histogram.count(), 10u);
+    EXPECT_EQ(histogram.percentile(0.5), 128u);
+    EXPECT_EQ(histogram.percentile(1.0), 8192u);
+}
+
+// A blocked acquisition is counted as contended with its wait and the holder's hold time
+TEST(LockStatsTest, ContendedAcquisition) {
+    reaction::ThreadManager::getInstance().enableThreadSafety();
+    auto &stats = reaction::LockStats::getInstance();
+    stats.reset();
+
+    reaction::ConditionalMutex mutex{reaction::LockClass::OTHER};
+    std::atomic<bool> held{false};
+    std::thread holder([&]() {
+        mutex.lock();
+        held = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        mutex.unlock();
+    });
+    while (!held) {
+        std::this_thread::yield();
+    }
+    mutex.lock();
+    mutex.unlock();
+    holder.join();
+
+    auto other = stats.snapshot(reaction::LockClass::OTHER);
+    if constexpr (reaction::LockStats::ENABLED) {
+        EXPECT_EQ(other.acquisitions, 2u);
+        EXPECT_EQ(other.contended, 1u);
+        EXPECT_EQ(other.wait.count(), 1u);
+        EXPECT_GE(other.wait.percentile(1.0), 1'000'000u);
+        EXPECT_EQ(other.hold.count(), 2u);
+    } else {
+        EXPECT_EQ(other.acquisitions, 0u);
+        EXPECT_EQ(other.hold.count(), 0u);
+    }
+}
+
+// Graph operations report under the classes of the locks they take
+TEST(LockStatsTest, GraphLockClasses) {
+    reaction::ThreadManager::getInstance().enableThreadSafety();
+    auto &stats = reaction::LockStats::getInstance();
+    stats.reset();
+
+    auto a = reaction::var(1);
+    auto b = reaction::calc([&]() { return a() + 1; });
+    a.value(2);
+    EXPECT_EQ(b.get(), 3);
+
+    for (auto lockClass : {reaction::LockClass::GRAPH, reaction::LockClass::RESOURCE, reaction::LockClass::FUNCTION}) {
+        auto snapshot = stats.snapshot(lockClass);
+        if constexpr (reaction::LockStats::ENABLED) {
+            EXPECT_GT(snapshot.acquisitions, 0u) << reaction::lockClassName(lockClass);
+        } else {
+            EXPECT_EQ(snapshot.acquisitions, 0u) << reaction::lockClassName(lockClass);
+        }
+    }
+    stats.reset();
+    EXPECT_EQ(stats.snapshot(reaction::LockClass::RESOURCE).acquisitions, 0u);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string writeArray(const std::string &name, const std::vector<double> &values) {
+    std::string path = ::testing::TempDir() + name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(double)));
+    return path;
+}
+
+std::vector<double> readArray(const std::string &path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::vector<double> values(static_cast<size_t>(in.tellg()) / sizeof(double));
+    in.seekg(0);
+    in.read(reinterpret_cast<char *>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(double)));
+    return values;
+}
+
+} // namespace
+
+// A mapped var feeds calcs and swapping the mapping notifies them
+TEST(MappedVarTest, RemapNotifies) {
+    const std::string first = writeArray("mapped_first.bin", {1.0, 2.0, 3.0});
+    const std::string second = writeArray("mapped_second.bin", {10.0, 20.0});
+
+    auto data = reaction::mappedVar<double>(first);
+    auto total = reaction::calc([](const reaction::MappedArray<double> &a) {
+        return std::accumulate(a.begin(), a.end(), 0.0);
+    }, data);
+    EXPECT_EQ(data.get().size(), 3u);
+    EXPECT_DOUBLE_EQ(total.get(), 6.0);
+
+    // A reader holding the old array keeps its mapping alive
+    reaction::MappedArray<double> old = data.get();
+    data.value(reaction::MappedArray<double>::open(second));
+    EXPECT_DOUBLE_EQ(total.get(), 30.0);
+    EXPECT_DOUBLE_EQ(old[2], 3.0);
+
+    std::remove(first.c_str());
+    std::remove(second.c_str());
+}
+
+// Copy-on-write edits stay private to the process and notify on re-assignment
+TEST(MappedVarTest, CopyOnWrite) {
+    const std::string path = writeArray("mapped_cow.bin", {1.0, 2.0});
+    auto data = reaction::mappedVar<double>(path, reaction::memory::MapMode::COPY_ON_WRITE);
+    int evaluations = 0;
+    auto total = reaction::calc([&](const reaction::MappedArray<double> &a) {
+        ++evaluations;
+        return a[0] + a[1];
+    }, data);
+
+    auto array = data.get();
+    array.mutableSpan()[0] = 5.0;
+    evaluations = 0;
+    data.value(array);
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_DOUBLE_EQ(total.get(), 7.0);
+    EXPECT_EQ(readArray(path), (std::vector<double>{1.0, 2.0}));
+
+    std::remove(path.c_str());
+}
+
+// Read-only mappings refuse writes and files must hold whole elements
+TEST(MappedVarTest, Errors) {
+    const std::string path = writeArray("mapped_ro.bin", {1.0});
+    auto array = reaction::MappedArray<double>::open(path);
+    EXPECT_THROW((void)array.mutableSpan(), reaction::InvalidStateException);
+    EXPECT_THROW((void)reaction::MappedArray<int64_t>::open(::testing::TempDir() + "mapped_missing.bin"), reaction::InvalidStateException);
+
+    std::ofstream(path, std::ios::binary | std::ios::app).put('x');
+    EXPECT_THROW((void)reaction::MappedArray<double>::open(path), reaction::InvalidStateException);
+    std::remove(path.c_str());
+}
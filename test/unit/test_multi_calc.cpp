@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <array>
+#include <string>
+#include <tuple>
+#include <utility>
+
+// One solver run per input change; only observers of changed elements recompute
+TEST(MultiCalcTest, IndependentOutputs) {
+    auto spot = reaction::var(100.0);
+    auto vol = reaction::var(0.2);
+    int solves = 0;
+    auto [price, delta, label] = reaction::multiCalc([&](double s, double v) {
+        ++solves;
+        return std::tuple{s * v, v > 0.1 ? 1 : 0, std::string(s > 50 ? "high" : "low")};
+    }, spot, vol);
+    EXPECT_EQ(solves, 1);
+    EXPECT_DOUBLE_EQ(price.get(), 20.0);
+    EXPECT_EQ(delta.get(), 1);
+    EXPECT_EQ(label.get(), "high");
+
+    int priceRuns = 0, deltaRuns = 0, labelRuns = 0;
+    auto onPrice = reaction::action([&](double) { ++priceRuns; }, price);
+    auto onDelta = reaction::action([&](int) { ++deltaRuns; }, delta);
+    auto onLabel = reaction::action([&](const std::string &) { ++labelRuns; }, label);
+
+    spot.value(200.0);
+    EXPECT_EQ(solves, 2);
+    EXPECT_DOUBLE_EQ(price.get(), 40.0);
+    EXPECT_EQ(priceRuns, 2);
+    EXPECT_EQ(deltaRuns, 1);
+    EXPECT_EQ(labelRuns, 1);
+
+    vol.value(0.05);
+    EXPECT_EQ(solves, 3);
+    EXPECT_EQ(delta.get(), 0);
+    EXPECT_EQ(priceRuns, 3);
+    EXPECT_EQ(deltaRuns, 2);
+    EXPECT_EQ(labelRuns, 1);
+
+    // Unchanged result: nothing downstream runs
+    vol.value(0.05);
+    EXPECT_EQ(solves, 3);
+    EXPECT_EQ(priceRuns, 3);
+}
+
+// Pairs and arrays work as results; outputs feed further calcs
+TEST(MultiCalcTest, TupleLikeResults) {
+    auto a = reaction::var(3);
+    auto [quot, rem] = reaction::multiCalc([](int x) { return std::pair{x / 2, x % 2}; }, a);
+    auto [lo, hi] = reaction::multiCalc([&]() { return std::array<int, 2>{a() - 1, a() + 1}; });
+    auto sum = reaction::calc([&]() { return quot() + rem() + lo() + hi(); });
+    EXPECT_EQ(sum.get(), 1 + 1 + 2 + 4);
+    a.value(8);
+    EXPECT_EQ(quot.get(), 4);
+    EXPECT_EQ(rem.get(), 0);
+    EXPECT_EQ(sum.get(), 4 + 0 + 7 + 9);
+}
+
+// Batched writes solve once and update the outputs in order
+TEST(MultiCalcTest, Batch) {
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    int solves = 0;
+    auto [sum, product] = reaction::multiCalc([&](int x, int y) { ++solves; return std::tuple{x + y, x * y}; }, a, b);
+    auto both = reaction::calc([&]() { return sum() * 100 + product(); });
+    EXPECT_EQ(both.get(), 302);
+    reaction::batchExecute([&]() {
+        a.value(3);
+        b.value(4);
+    });
+    EXPECT_EQ(sum.get(), 7);
+    EXPECT_EQ(product.get(), 12);
+    EXPECT_EQ(solves, 2);
+    EXPECT_EQ(both.get(), 712);
+}
+
+// Closing an input closes the computation and all of its outputs
+TEST(MultiCalcTest, Close) {
+    auto a = reaction::var(1);
+    auto [x, y] = reaction::multiCalc([&]() { return std::tuple{a(), a() * 2}; });
+    a.close();
+    EXPECT_FALSE(static_cast<bool>(x));
+    EXPECT_FALSE(static_cast<bool>(y));
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <set>
+
+// Test that equal names share one interned handle
+TEST(NameTableTest, TestInterning) {
+    auto &table = reaction::NameTable::getInstance();
+    auto first = table.intern("interned_node");
+    auto again = table.intern(std::string("interned_node"));
+    auto other = table.intern("interned_other");
+
+    EXPECT_NE(first, reaction::NO_NAME);
+    EXPECT_EQ(first, again);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(table.view(first), "interned_node");
+    EXPECT_EQ(table.intern(""), reaction::NO_NAME);
+    EXPECT_EQ(table.view(reaction::NO_NAME), "");
+}
+
+// Test that node names are stored as handles and can be renamed
+TEST(NameTableTest, TestNodeNames) {
+    auto a = reaction::var(1).setName("named_a");
+    auto b = reaction::var(2).setName("named_a");
+    auto c = reaction::var(3);
+
+    EXPECT_EQ(a.getName(), "named_a");
+    EXPECT_EQ(b.getName(), "named_a");
+    EXPECT_EQ(c.getName(), "");
+
+    b.setName("named_b");
+    EXPECT_EQ(b.getName(), "named_b");
+}
+
+// Test that ordered containers of handles order by node id
+TEST(NameTableTest, TestIdOrdering) {
+    auto first = reaction::var(1).setName("zzz");
+    auto second = reaction::var(2).setName("aaa");
+    auto unnamed1 = reaction::var(3);
+    auto unnamed2 = reaction::var(4);
+
+    EXPECT_TRUE(first < second);
+    EXPECT_FALSE(second < first);
+
+    // Unnamed handles used to compare equal and collapse in a set
+    std::set<reaction::Var<int>> handles{first, second, unnamed1, unnamed2, first};
+    EXPECT_EQ(handles.size(), 4u);
+    EXPECT_EQ(*handles.begin(), first);
+}
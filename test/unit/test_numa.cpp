@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+// Topologies can be described in cpulist syntax
+TEST(NumaTest, ParseTopology) {
+    auto topology = reaction::NumaTopology::parse("0-3,8;4-7");
+    ASSERT_EQ(topology.size(), 2u);
+    EXPECT_EQ(topology.cpus(0), (std::vector<uint32_t>{0, 1, 2, 3, 8}));
+    EXPECT_EQ(topology.cpus(1), (std::vector<uint32_t>{4, 5, 6, 7}));
+
+    EXPECT_THROW(reaction::NumaTopology::parse("0-3;"), reaction::InvalidStateException);
+    EXPECT_THROW(reaction::NumaTopology::parse("0-x"), reaction::InvalidStateException);
+    EXPECT_GE(reaction::NumaTopology::detect().size(), 1u);
+}
+
+// Work for a partition runs on the workers of its owning node
+TEST(NumaTest, PartitionsRunOnOwningNode) {
+    reaction::NumaWorkerPool pool(reaction::NumaTopology::simulated(2, 2));
+    EXPECT_EQ(reaction::NumaWorkerPool::currentNode(), reaction::NumaWorkerPool::NO_NODE);
+
+    pool.assign(7, 0);
+    EXPECT_EQ(pool.nodeOf(7), 0u);
+    EXPECT_EQ(pool.nodeOf(3), 1u); // round-robin by id
+    EXPECT_EQ(pool.submit(7, [] { return reaction::NumaWorkerPool::currentNode(); }).get(), 0u);
+    EXPECT_EQ(pool.submit(3, [] { return reaction::NumaWorkerPool::currentNode(); }).get(), 1u);
+    EXPECT_THROW(pool.assign(1, 2), reaction::InvalidStateException);
+}
+
+// Partitions are built and propagated on their own nodes
+TEST(NumaTest, PartitionedGraph) {
+    reaction::NumaWorkerPool pool(reaction::NumaTopology::simulated(2, 1));
+    using Source = decltype(reaction::var(0));
+    using Sum = decltype(reaction::calc([](int x) { return x; }, std::declval<Source &>()));
+    struct Partition {
+        Source source;
+        Sum doubled;
+    };
+
+    std::vector<Partition> partitions;
+    for (reaction::PartitionId id = 0; id < 4; ++id) {
+        partitions.push_back(pool.submit(id, [] {
+            auto source = reaction::var(0);
+            auto doubled = reaction::calc([](int x) { return x * 2; }, source);
+            return Partition{source, doubled};
+        }).get());
+    }
+
+    std::vector<std::future<void>> writes;
+    for (int round = 1; round <= 100; ++round) {
+        for (reaction::PartitionId id = 0; id < 4; ++id) {
+            writes.push_back(pool.submit(id, [&partitions, id, round] { partitions[id].source.value(round + static_cast<int>(id)); }));
+        }
+    }
+    for (auto &write : writes) {
+        write.get();
+    }
+    for (reaction::PartitionId id = 0; id < 4; ++id) {
+        EXPECT_EQ(partitions[id].doubled.get(), (100 + static_cast<int>(id)) * 2);
+    }
+}
+
+// Exceptions thrown by partition work reach the submitter
+TEST(NumaTest, ExceptionsPropagate) {
+    reaction::NumaWorkerPool pool(reaction::NumaTopology::simulated(1, 1));
+    auto result = pool.submit(0, []() -> int { throw std::runtime_error("boom"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+    EXPECT_EQ(pool.submit(0, [] { return 42; }).get(), 42);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+
+// Re-binding to the same dependencies keeps every edge and recomputes downstream
+TEST(RebindTest, ResetWithSameDependencies) {
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    auto sum = reaction::calc([](int x, int y) { return x + y; }, a, b);
+    auto doubled = reaction::calc([&]() { return sum() * 2; });
+    EXPECT_EQ(doubled.get(), 6);
+
+    for (int i = 1; i <= 10; ++i) {
+        sum.reset([i](int x, int y) { return x + y + i; }, a, b);
+        EXPECT_EQ(sum.get(), 3 + i);
+        EXPECT_EQ(doubled.get(), (3 + i) * 2);
+    }
+
+    a.value(5);
+    EXPECT_EQ(sum.get(), 17);
+    EXPECT_EQ(doubled.get(), 34);
+}
+
+// Only the difference between the old and new dependency lists is applied
+TEST(RebindTest, ResetDiffsDependencies) {
+    auto a = reaction::var(1);
+    auto b = reaction::var(10);
+    auto c = reaction::var(100);
+    int evaluations = 0;
+    auto calc = reaction::calc([&]() {
+        ++evaluations;
+        return a() + b();
+    });
+    EXPECT_EQ(calc.get(), 11);
+
+    calc.reset([&]() {
+        ++evaluations;
+        return b() + c();
+    });
+    EXPECT_EQ(calc.get(), 110);
+
+    // The dropped edge no longer triggers recomputation
+    evaluations = 0;
+    a.value(2);
+    EXPECT_EQ(evaluations, 0);
+    EXPECT_EQ(calc.get(), 110);
+
+    // Kept and added edges do
+    b.value(20);
+    EXPECT_EQ(calc.get(), 120);
+    c.value(200);
+    EXPECT_EQ(calc.get(), 220);
+    EXPECT_EQ(evaluations, 2);
+}
+
+// Duplicate reads of one dependency produce a single edge
+TEST(RebindTest, ResetWithRepeatedReads) {
+    auto a = reaction::var(1);
+    int evaluations = 0;
+    auto calc = reaction::calc([&]() {
+        ++evaluations;
+        return a() + a() + a();
+    });
+    EXPECT_EQ(calc.get(), 3);
+
+    calc.reset([&]() {
+        ++evaluations;
+        return a() * a();
+    });
+    evaluations = 0;
+    a.value(4);
+    EXPECT_EQ(calc.get(), 16);
+    EXPECT_EQ(evaluations, 1);
+}
+
+// A rejected new edge restores the removed ones
+TEST(RebindTest, CycleRollbackRestoresRemovedEdges) {
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    auto calc = reaction::calc([](int x, int y) { return x + y; }, a, b);
+    auto downstream = reaction::calc([](int x) { return x * 10; }, calc);
+    EXPECT_EQ(downstream.get(), 30);
+
+    // Drops a and b, adds downstream - which observes calc
+    EXPECT_THROW(calc.reset([&]() { return downstream() + 1; }), std::runtime_error);
+
+    EXPECT_EQ(calc.get(), 3);
+    a.value(5);
+    EXPECT_EQ(calc.get(), 7);
+    EXPECT_EQ(downstream.get(), 70);
+    b.value(0);
+    EXPECT_EQ(calc.get(), 5);
+}
+
+// Many resets inside one transaction recompute shared descendants once
+TEST(RebindTest, TransactionCoalescesPropagation) {
+    auto a = reaction::var(1);
+    std::vector<reaction::React<reaction::CalcExpr, int, reaction::KeepHandle, reaction::ChangeTrig>> calcs;
+    for (int i = 0; i < 8; ++i) {
+        calcs.push_back(reaction::calc([i](int x) { return x + i; }, a));
+    }
+    int evaluations = 0;
+    auto total = reaction::calc([&]() {
+        ++evaluations;
+        int sum = 0;
+        for (auto &c : calcs) sum += c();
+        return sum;
+    });
+    EXPECT_EQ(total.get(), 8 + 28);
+
+    evaluations = 0;
+    reaction::rebindAll([&]() {
+        for (int i = 0; i < 8; ++i) {
+            calcs[i].reset([i](int x) { return x * i; }, a);
+        }
+        // Downstream has not been recomputed yet
+        EXPECT_EQ(evaluations, 0);
+    });
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(total.get(), 28);
+
+    // Without a transaction every reset propagates on its own
+    evaluations = 0;
+    for (int i = 0; i < 8; ++i) {
+        calcs[i].reset([i](int x) { return x * i + 1; }, a);
+    }
+    EXPECT_EQ(evaluations, 8);
+    EXPECT_EQ(total.get(), 36);
+}
+
+// Nested transactions hand their resets to the outermost one
+TEST(RebindTest, NestedTransactions) {
+    auto a = reaction::var(1);
+    auto c1 = reaction::calc([](int x) { return x; }, a);
+    auto c2 = reaction::calc([](int x) { return x; }, a);
+    int evaluations = 0;
+    auto total = reaction::calc([&]() {
+        ++evaluations;
+        return c1() + c2();
+    });
+
+    evaluations = 0;
+    {
+        reaction::GraphTransaction outer;
+        c1.reset([](int x) { return x + 1; }, a);
+        {
+            reaction::GraphTransaction inner;
+            c2.reset([](int x) { return x + 2; }, a);
+        }
+        EXPECT_EQ(evaluations, 0);
+    }
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(total.get(), 5);
+
+    // Later writes propagate normally again
+    a.value(2);
+    EXPECT_EQ(total.get(), 7);
+}
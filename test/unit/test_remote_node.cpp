@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+#include <string>
+
+#if REACTION_HAS_UNIX_SOCKETS
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Values published on one side feed the bound Vars on the other
+TEST(RemoteNodeTest, ShipsValuesAcrossPartitions) {
+    auto [sender, receiver] = reaction::UnixSocketTransport::pair();
+
+    auto price = reaction::var(10.0);
+    auto qty = reaction::var(2);
+    auto notional = reaction::calc([](double p, int q) { return p * q; }, price, qty);
+    reaction::RemoteOutput output(sender);
+    output.publish(1, price).publish(2, notional);
+
+    auto remotePrice = reaction::var(0.0);
+    auto remoteNotional = reaction::var(0.0);
+    auto spread = reaction::calc([](double p, double n) { return n - p; }, remotePrice, remoteNotional);
+    reaction::RemoteInput input(receiver);
+    input.bind(1, remotePrice).bind(2, remoteNotional);
+
+    EXPECT_TRUE(output.flush());
+    EXPECT_EQ(input.poll(), 1u);
+    EXPECT_DOUBLE_EQ(remotePrice.get(), 10.0);
+    EXPECT_DOUBLE_EQ(spread.get(), 10.0);
+
+    price.value(12.0);
+    output.flush();
+    EXPECT_EQ(input.poll(), 1u);
+    EXPECT_DOUBLE_EQ(remoteNotional.get(), 24.0);
+    EXPECT_DOUBLE_EQ(spread.get(), 12.0);
+
+    // Nothing staged, nothing sent
+    EXPECT_FALSE(output.flush());
+    EXPECT_EQ(input.poll(), 0u);
+}
+
+// All changes of one epoch travel in one frame and are applied as one batch
+TEST(RemoteNodeTest, CoalescesPerEpoch) {
+    auto [sender, receiver] = reaction::UnixSocketTransport::pair();
+
+    auto a = reaction::var(1);
+    auto b = reaction::var(2);
+    reaction::RemoteOutput output(sender);
+    output.publish(1, a).publish(2, b);
+    output.flush();
+
+    auto ra = reaction::var(0);
+    auto rb = reaction::var(0);
+    int evaluations = 0;
+    auto sum = reaction::calc([&](int x, int y) {
+        ++evaluations;
+        return x + y;
+    }, ra, rb);
+    reaction::RemoteInput input(receiver);
+    input.bind(1, ra).bind(2, rb);
+    input.poll();
+    EXPECT_EQ(sum.get(), 3);
+
+    // One batch: one epoch, one frame, one downstream recompute
+    const size_t sent = output.framesSent();
+    reaction::batchExecute([&]() {
+        a.value(10);
+        b.value(20);
+    });
+    output.flush();
+    EXPECT_EQ(output.framesSent(), sent + 1);
+
+    evaluations = 0;
+    EXPECT_EQ(input.poll(), 1u);
+    EXPECT_EQ(sum.get(), 30);
+    EXPECT_EQ(evaluations, 1);
+
+    // A newer epoch ships the previous one first
+    a.value(11);
+    a.value(12);
+    EXPECT_EQ(output.framesSent(), sent + 2);
+    output.flush();
+    EXPECT_EQ(input.poll(), 2u);
+    EXPECT_EQ(ra.get(), 12);
+}
+
+// Mismatched value sizes are rejected before anything is written
+TEST(RemoteNodeTest, TypeMismatch) {
+    auto [sender, receiver] = reaction::UnixSocketTransport::pair();
+    auto a = reaction::var(1.0);
+    reaction::RemoteOutput output(sender);
+    output.publish(7, a);
+    EXPECT_THROW(output.publish(7, a), reaction::InvalidStateException);
+    output.flush();
+
+    auto wrong = reaction::var(int32_t{0});
+    reaction::RemoteInput input(receiver);
+    input.bind(7, wrong);
+    EXPECT_THROW(input.poll(), reaction::TypeMismatchException);
+    EXPECT_EQ(wrong.get(), 0);
+}
+
+// A partition in another process, connected through a named socket
+TEST(RemoteNodeTest, CrossProcessPartition) {
+    const std::string path = "/tmp/reaction_remote_" + std::to_string(::getpid()) + ".sock";
+    reaction::UnixSocketListener listener(path);
+
+    pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        // Child partition: doubles the remote value and sends it back
+        auto transport = reaction::UnixSocketTransport::connect(path);
+        auto in = reaction::var(int64_t{0});
+        auto doubled = reaction::calc([](int64_t x) { return x * 2; }, in);
+        reaction::RemoteInput input(transport);
+        input.bind(1, in);
+        reaction::RemoteOutput output(transport);
+        output.publish(2, doubled);
+        for (int spins = 0; spins < 500'000; ++spins) {
+            if (input.poll() > 0) {
+                output.flush();
+                if (in.get() == 21) ::_exit(0);
+            }
+            ::usleep(20);
+        }
+        ::_exit(1);
+    }
+
+    auto transport = listener.accept();
+    auto value = reaction::var(int64_t{21});
+    reaction::RemoteOutput output(transport);
+    output.publish(1, value);
+    output.flush();
+
+    auto result = reaction::var(int64_t{0});
+    reaction::RemoteInput input(transport);
+    input.bind(2, result);
+    for (int spins = 0; spins < 500'000 && result.get() != 42; ++spins) {
+        input.poll();
+        ::usleep(20);
+    }
+    EXPECT_EQ(result.get(), 42);
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+#endif
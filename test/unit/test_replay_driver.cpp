@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <cstdio>
+#include <filesystem>
+
+class ReplayDriverTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = (std::filesystem::temp_directory_path() / ("reaction_replay_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".col")).string();
+        reaction::ColumnarWriter writer;
+        writer.addColumn("price", std::vector<double>{10.0, 11.0, 12.5, 12.0})
+            .addColumn("volume", std::vector<int64_t>{100, 200, 50, 400});
+        writer.write(m_path);
+    }
+
+    void TearDown() override {
+        std::remove(m_path.c_str());
+    }
+
+    std::string m_path;
+};
+
+// Test that every row propagates through an unchanged live graph
+TEST_F(ReplayDriverTest, TestReplayDrivesGraph) {
+    reaction::ColumnarFile file(m_path);
+    EXPECT_EQ(file.rows(), 4u);
+    EXPECT_EQ(file.columns().size(), 2u);
+
+    auto price = reaction::var(0.0);
+    auto volume = reaction::var(int64_t{0});
+    auto notional = reaction::calc([](double p, int64_t v) { return p * static_cast<double>(v); }, price, volume);
+
+    std::vector<double> seen;
+    int actions = 0;
+    auto logger = reaction::action([&](double n) { seen.push_back(n); ++actions; }, notional);
+    actions = 0;
+    seen.clear();
+
+    reaction::ReplayDriver driver(file);
+    driver.bind("price", price).bind("volume", volume);
+    auto stats = driver.run();
+
+    EXPECT_EQ(stats.ticks, 4u);
+    EXPECT_GT(stats.ticksPerSecond(), 0.0);
+    EXPECT_EQ(actions, 4);
+    EXPECT_EQ(seen, (std::vector<double>{1000.0, 2200.0, 625.0, 4800.0}));
+    EXPECT_DOUBLE_EQ(notional.get(), 4800.0);
+}
+
+// Test row ranges and the per-tick hook
+TEST_F(ReplayDriverTest, TestRangeAndHook) {
+    reaction::ColumnarFile file(m_path);
+    auto price = reaction::var(0.0);
+    auto doubled = reaction::calc([](double p) { return p * 2; }, price);
+
+    reaction::ReplayDriver driver(file);
+    driver.bind("price", price);
+
+    std::vector<double> seen;
+    auto stats = driver.run({.firstRow = 1, .rowCount = 2, .onTick = [&](size_t) { seen.push_back(doubled.get()); }});
+    EXPECT_EQ(stats.ticks, 2u);
+    EXPECT_EQ(seen, (std::vector<double>{22.0, 25.0}));
+}
+
+// Test binding errors
+TEST_F(ReplayDriverTest, TestBindErrors) {
+    reaction::ColumnarFile file(m_path);
+    auto price = reaction::var(0.0);
+    auto wrongType = reaction::var(int32_t{0});
+
+    reaction::ReplayDriver driver(file);
+    EXPECT_THROW(driver.bind("missing", price), reaction::InvalidStateException);
+    EXPECT_THROW(driver.bind("volume", wrongType), reaction::TypeMismatchException);
+    EXPECT_THROW(reaction::ColumnarFile("/nonexistent/reaction.col"), reaction::InvalidStateException);
+}
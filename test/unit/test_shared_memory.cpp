@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+
+#if REACTION_HAS_SHM
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+struct Quote {
+    double bid;
+    double ask;
+    int64_t size;
+};
+
+std::string segmentName(const char *suffix) {
+    return "/reaction_test_" + std::to_string(::getpid()) + "_" + suffix;
+}
+
+} // namespace
+
+// Exported vars and calcs are mirrored on creation and on every change
+TEST(SharedMemoryTest, MirrorsValues) {
+    const std::string name = segmentName("mirror");
+    reaction::SharedMemoryExporter exporter(name, 4);
+
+    auto price = reaction::var(100.0);
+    auto qty = reaction::var(3);
+    auto notional = reaction::calc([](double p, int q) { return p * q; }, price, qty);
+    exporter.publish("price", price).publish("notional", notional);
+    EXPECT_EQ(exporter.size(), 2u);
+
+    reaction::SharedMemoryReader reader(name);
+    EXPECT_EQ(reader.names(), (std::vector<std::string>{"price", "notional"}));
+    auto priceSlot = reader.find<double>("price");
+    auto notionalSlot = reader.find<double>("notional");
+    EXPECT_DOUBLE_EQ(priceSlot.get(), 100.0);
+    EXPECT_DOUBLE_EQ(notionalSlot.get(), 300.0);
+
+    const uint64_t version = notionalSlot.version();
+    price.value(101.5);
+    EXPECT_DOUBLE_EQ(priceSlot.get(), 101.5);
+    EXPECT_DOUBLE_EQ(notionalSlot.get(), 304.5);
+    EXPECT_GT(notionalSlot.version(), version);
+    ASSERT_TRUE(notionalSlot.tryGet().has_value());
+}
+
+// Structs are stored as whole values
+TEST(SharedMemoryTest, TriviallyCopyableStruct) {
+    const std::string name = segmentName("struct");
+    reaction::SharedMemoryExporter exporter(name, 1);
+    auto quote = reaction::var(Quote{1.0, 1.5, 10});
+    exporter.publish("quote", quote);
+
+    reaction::SharedMemoryReader reader(name);
+    quote.value(Quote{2.0, 2.5, 20});
+    Quote read = reader.find<Quote>("quote").get();
+    EXPECT_DOUBLE_EQ(read.bid, 2.0);
+    EXPECT_DOUBLE_EQ(read.ask, 2.5);
+    EXPECT_EQ(read.size, 20);
+}
+
+// Readers never observe a torn value while a writer is updating it
+TEST(SharedMemoryTest, ConcurrentReadsAreConsistent) {
+    const std::string name = segmentName("torn");
+    reaction::SharedMemoryExporter exporter(name, 1);
+    auto quote = reaction::var(Quote{0.0, 0.0, 0});
+    exporter.publish("quote", quote);
+    reaction::SharedMemoryReader reader(name);
+    auto slot = reader.find<Quote>("quote");
+
+    std::atomic<bool> done{false};
+    std::thread readerThread([&] {
+        while (!done.load()) {
+            Quote q = slot.get();
+            ASSERT_EQ(q.bid, q.ask);
+            ASSERT_EQ(static_cast<int64_t>(q.bid), q.size);
+        }
+    });
+    for (int64_t i = 1; i <= 2000; ++i) {
+        quote.value(Quote{static_cast<double>(i), static_cast<double>(i), i});
+    }
+    done.store(true);
+    readerThread.join();
+    EXPECT_EQ(slot.get().size, 2000);
+}
+
+// Misuse is reported instead of corrupting the segment
+TEST(SharedMemoryTest, Errors) {
+    const std::string name = segmentName("errors");
+    reaction::SharedMemoryExporter exporter(name, 1, 8);
+    auto a = reaction::var(1.0);
+    auto b = reaction::var(2.0);
+    auto big = reaction::var(Quote{});
+    EXPECT_THROW(exporter.publish("big", big), reaction::InvalidStateException);
+    exporter.publish("a", a);
+    EXPECT_THROW(exporter.publish("b", b), reaction::InvalidStateException);
+
+    reaction::SharedMemoryReader reader(name);
+    EXPECT_THROW((void)reader.find<double>("missing"), reaction::InvalidStateException);
+    EXPECT_THROW((void)reader.find<int32_t>("a"), reaction::TypeMismatchException);
+    EXPECT_THROW(reaction::SharedMemoryReader(segmentName("absent")), reaction::InvalidStateException);
+}
+
+// A reader in another process observes updates made after it attached
+TEST(SharedMemoryTest, CrossProcessReader) {
+    const std::string name = segmentName("process");
+    reaction::SharedMemoryExporter exporter(name, 1);
+    auto counter = reaction::var(int64_t{0});
+    exporter.publish("counter", counter);
+
+    pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        // Child: wait until the parent's last write is visible
+        reaction::SharedMemoryReader reader(name);
+        auto slot = reader.find<int64_t>("counter");
+        for (int spins = 0; spins < 5'000'000; ++spins) {
+            if (slot.get() == 1000) ::_exit(0);
+            ::usleep(10);
+        }
+        ::_exit(1);
+    }
+
+    for (int64_t i = 1; i <= 1000; ++i) {
+        counter.value(i);
+    }
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <tuple>
+
+// A skip keeps the previous value and nothing downstream recomputes
+TEST(SkipCalcTest, SkipVetoesPropagation) {
+    auto samples = reaction::var(10);
+    auto mean = reaction::calc([](int n) -> reaction::Skippable<double> {
+        if (n < 5) return reaction::skip;
+        return n * 0.5;
+    }, samples);
+    static_assert(std::is_same_v<decltype(mean), reaction::SkipCalc<double>>);
+    EXPECT_DOUBLE_EQ(mean.get(), 5.0);
+
+    int plainRuns = 0, alwaysRuns = 0;
+    auto report = reaction::calc([&](double m) { ++plainRuns; return m * 2; }, mean);
+    auto audit = reaction::calc<reaction::AlwaysTrig>([&](double m) { ++alwaysRuns; return m; }, mean);
+    EXPECT_EQ(plainRuns, 1);
+    EXPECT_EQ(alwaysRuns, 1);
+
+    samples.value(3);
+    EXPECT_DOUBLE_EQ(mean.get(), 5.0);
+    EXPECT_EQ(plainRuns, 1);
+    EXPECT_EQ(alwaysRuns, 1);
+
+    samples.value(20);
+    EXPECT_DOUBLE_EQ(mean.get(), 10.0);
+    EXPECT_DOUBLE_EQ(report.get(), 20.0);
+    EXPECT_EQ(plainRuns, 2);
+    EXPECT_EQ(alwaysRuns, 2);
+}
+
+// Skipping the first evaluation leaves the node without a value until one is produced
+TEST(SkipCalcTest, SkipFirstEvaluation) {
+    auto a = reaction::var(0);
+    auto gated = reaction::calc([&]() -> reaction::Skippable<int> {
+        if (a() == 0) return reaction::skip;
+        return a() * 10;
+    });
+    EXPECT_THROW((void)gated.get(), reaction::ReactionException);
+    a.value(2);
+    EXPECT_EQ(gated.get(), 20);
+}
+
+// Resetting works with plain and skippable functions; combines with multiCalc
+TEST(SkipCalcTest, ResetAndMultiCalc) {
+    auto a = reaction::var(1);
+    auto gated = reaction::calc([&]() -> reaction::Skippable<int> { return a(); });
+    gated.reset([&]() { return a() + 100; });
+    EXPECT_EQ(gated.get(), 101);
+
+    int solves = 0;
+    auto [lo, hi] = reaction::multiCalc([&]() -> reaction::Skippable<std::tuple<int, int>> {
+        ++solves;
+        if (a() < 0) return reaction::skip;
+        return std::tuple{a() - 1, a() + 1};
+    });
+    a.value(-5);
+    EXPECT_EQ(solves, 2);
+    EXPECT_EQ(lo.get(), 0);
+    EXPECT_EQ(hi.get(), 2);
+    a.value(5);
+    EXPECT_EQ(lo.get(), 4);
+    EXPECT_EQ(hi.get(), 6);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+
+/**
+ * @brief Fixture that leaves sliced propagation disabled after every test.
+ */
+class SlicedPropagationTest : public ReactionTestBase {
+protected:
+    void TearDown() override {
+        reaction::PropagationScheduler::getInstance().disable();
+    }
+};
+
+// Test that work beyond the node budget is parked and resumed in later slices
+TEST_F(SlicedPropagationTest, TestNodeBudgetParksWork) {
+    auto &scheduler = reaction::PropagationScheduler::getInstance();
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int aa) { return aa + 1; }, a);
+    auto c = reaction::calc([](int bb) { return bb + 1; }, b);
+    auto d = reaction::calc([](int cc) { return cc + 1; }, c);
+
+    scheduler.enable({.maxNodes = 1});
+    a.value(10);
+
+    EXPECT_EQ(scheduler.pendingCount(), 2u);
+    EXPECT_FALSE(b.isStale());
+    EXPECT_TRUE(d.isStale());
+
+    EXPECT_EQ(scheduler.runSlice(), 1u);
+    EXPECT_EQ(scheduler.pendingCount(), 1u);
+    EXPECT_EQ(scheduler.runSlice(), 1u);
+    EXPECT_FALSE(scheduler.hasPending());
+    EXPECT_EQ(d.get(), 13);
+}
+
+// Test that reading a parked node pulls its inputs up to date first
+TEST_F(SlicedPropagationTest, TestReadPullsStaleNode) {
+    auto &scheduler = reaction::PropagationScheduler::getInstance();
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int aa) { return aa * 2; }, a);
+    auto c = reaction::calc([](int aa, int bb) { return aa + bb; }, a, b);
+    auto d = reaction::calc([](int cc) { return cc * 10; }, c);
+
+    scheduler.enable({.maxNodes = 1});
+    a.value(5);
+    ASSERT_TRUE(scheduler.hasPending());
+
+    EXPECT_EQ(d.get(), 150);
+    EXPECT_FALSE(scheduler.hasPending());
+}
+
+// Test that repeated writes to a parked cone evaluate each node only once
+TEST_F(SlicedPropagationTest, TestRepeatedWritesCoalesce) {
+    auto &scheduler = reaction::PropagationScheduler::getInstance();
+    int triggerCount = 0;
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int aa) { return aa + 1; }, a);
+    auto c = reaction::calc([&](int bb) { ++triggerCount; return bb; }, b);
+    triggerCount = 0;
+
+    scheduler.enable({.maxNodes = 1});
+    a.value(2);
+    a.value(3);
+    a.value(4);
+    scheduler.drain();
+
+    EXPECT_EQ(triggerCount, 1);
+    EXPECT_EQ(c.get(), 5);
+}
+
+// Test that disabling the scheduler drains parked work and restores eager propagation
+TEST_F(SlicedPropagationTest, TestDisableDrains) {
+    auto &scheduler = reaction::PropagationScheduler::getInstance();
+    auto a = reaction::var(1);
+    auto b = reaction::calc([](int aa) { return aa + 1; }, a);
+    auto c = reaction::calc([](int bb) { return bb + 1; }, b);
+
+    scheduler.enable({.maxNodes = 1});
+    a.value(2);
+    EXPECT_TRUE(c.isStale());
+
+    scheduler.disable();
+    EXPECT_FALSE(c.isStale());
+    EXPECT_EQ(c.get(), 4);
+
+    a.value(3);
+    EXPECT_FALSE(scheduler.hasPending());
+    EXPECT_EQ(c.get(), 5);
+}
+
+// Test that a time budget bounds the slice and the remainder is resumed
+TEST_F(SlicedPropagationTest, TestTimeBudget) {
+    auto &scheduler = reaction::PropagationScheduler::getInstance();
+    auto a = reaction::var(0);
+    std::vector<reaction::Calc<int>> chain;
+    chain.push_back(reaction::calc([](int aa) { return aa + 1; }, a));
+    for (int i = 1; i < 50; ++i) {
+        chain.push_back(reaction::calc([](int prev) { return prev + 1; }, chain.back()));
+    }
+
+    scheduler.enable({.maxTime = std::chrono::nanoseconds{1}});
+    a.value(100);
+    EXPECT_TRUE(scheduler.hasPending());
+
+    size_t slices = 1;
+    while (scheduler.hasPending()) {
+        scheduler.runSlice();
+        ++slices;
+    }
+    EXPECT_GT(slices, 1u);
+    EXPECT_EQ(chain.back().get(), 150);
+}
@@ -45,4 +45,53 @@ TEST(TriggerTest, TestFilterTrig) {
 
     a.value(5);
     EXPECT_EQ(dds.get(), 8);
-}
\ No newline at end of file
+}
+// Adaptive trigger turns lazy for write-heavy nodes and eager again for read-heavy ones
+TEST(TriggerTest, TestAdaptiveTrig) {
+    auto a = reaction::var(0);
+    int evaluations = 0;
+    auto b = reaction::calc<reaction::AdaptiveTrig>([&]() { ++evaluations; return a() * 2; });
+    EXPECT_FALSE(b.isLazy());
+
+    // Unread updates make the node lazy
+    for (int i = 1; i <= 200; ++i) {
+        a.value(i);
+    }
+    EXPECT_TRUE(b.isLazy());
+    int before = evaluations;
+    for (int i = 201; i <= 300; ++i) {
+        a.value(i);
+    }
+    EXPECT_EQ(evaluations, before);
+    EXPECT_EQ(b.get(), 600);
+    EXPECT_EQ(evaluations, before + 1);
+    EXPECT_EQ(b.get(), 600);
+    EXPECT_EQ(evaluations, before + 1);
+
+    // Reading after every update makes it eager again
+    for (int i = 0; i < 200; ++i) {
+        a.value(1000 + i);
+        EXPECT_EQ(b.get(), 2 * (1000 + i));
+    }
+    EXPECT_FALSE(b.isLazy());
+}
+
+// Observers of a lazy node pull its value when they recompute
+TEST(TriggerTest, TestAdaptiveTrigObservers) {
+    auto a = reaction::var(0);
+    auto b = reaction::calc<reaction::AdaptiveTrig>([&]() { return a() + 1; });
+    for (int i = 1; i <= 200; ++i) {
+        a.value(i);
+    }
+    ASSERT_TRUE(b.isLazy());
+
+    int seen = 0;
+    auto c = reaction::calc([&]() { return b() * 10; });
+    auto sink = reaction::action([&](int v) { seen = v; }, c);
+    a.value(500);
+    EXPECT_EQ(c.get(), 5010);
+    EXPECT_EQ(seen, 5010);
+
+    reaction::batchExecute([&]() { a.value(7); });
+    EXPECT_EQ(seen, 80);
+}
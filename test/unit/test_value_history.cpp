@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+
+// Test that past epochs read a consistent snapshot across a var and its calc
+TEST(ValueHistoryTest, TestConsistentPastReads) {
+    auto &feed = reaction::ChangeFeed::getInstance();
+    auto a = reaction::var(1).keepHistory(8);
+    auto b = reaction::calc([](int aa) { return aa * 10; }, a).keepHistory(8);
+
+    uint64_t start = feed.now();
+    a.value(2);
+    uint64_t second = feed.now();
+    a.value(3);
+
+    EXPECT_EQ(a.getAt(start), 1);
+    EXPECT_EQ(b.getAt(start), 10);
+    EXPECT_EQ(a.getAt(second), 2);
+    EXPECT_EQ(b.getAt(second), 20);
+    EXPECT_EQ(a.getAt(feed.now()), 3);
+    EXPECT_EQ(b.getAt(feed.now()), 30);
+}
+
+// Test that epochs older than the retained window are reported as unavailable
+TEST(ValueHistoryTest, TestWindowExpiry) {
+    auto &feed = reaction::ChangeFeed::getInstance();
+    auto a = reaction::var(0).keepHistory(3);
+    auto plain = reaction::var(0);
+
+    uint64_t start = feed.now();
+    for (int i = 1; i <= 5; ++i) {
+        a.value(i);
+    }
+
+    EXPECT_FALSE(a.getAt(start).has_value());
+    EXPECT_FALSE(plain.getAt(start).has_value());
+    auto entries = a.getHistory();
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].value, 3);
+    EXPECT_EQ(entries[1].value, 4);
+    EXPECT_EQ(entries[2].value, 5);
+    EXPECT_LT(entries[0].epoch, entries[2].epoch);
+}
+
+// Test that several writes inside one batch collapse into a single entry
+TEST(ValueHistoryTest, TestBatchCollapse) {
+    auto a = reaction::var(1).keepHistory(4);
+    auto b = reaction::var(2);
+    auto sum = reaction::calc([](int aa, int bb) { return aa + bb; }, a, b).keepHistory(4);
+
+    reaction::batchExecute([&]() {
+        a.value(5);
+        a.value(7);
+        b.value(3);
+    });
+
+    auto entries = sum.getHistory();
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries[0].value, 3);
+    EXPECT_EQ(entries[1].value, 10);
+    EXPECT_EQ(a.getHistory().back().value, 7);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025 Lummy
+ *
+ * This software is released under the MIT License.
+ * See the LICENSE file in the project root for full details.
+ */
+
+#include "../common/test_fixtures.h"
+#include "../common/test_helpers.h"
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+/// Resets the process-wide watchdog around each test.
+class WatchdogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        reset();
+    }
+
+    void TearDown() override {
+        reset();
+    }
+
+    static void reset() {
+        auto &watchdog = reaction::Watchdog::getInstance();
+        watchdog.setHandler({});
+        watchdog.setChronicThreshold(reaction::Watchdog::DEFAULT_CHRONIC_THRESHOLD);
+        watchdog.clearChronicOffenders();
+    }
+};
+
+} // namespace
+
+// An evaluation past its budget is reported with the node's name and timings
+TEST_F(WatchdogTest, ReportsSlowEvaluation) {
+    std::vector<reaction::SlowCalcReport> reports;
+    std::string name;
+    reaction::Watchdog::getInstance().setHandler([&](const reaction::SlowCalcReport &report) {
+        reports.push_back(report);
+        name = std::string(report.name);
+    });
+
+    auto delay = reaction::var(0);
+    auto slow = reaction::calc([](int ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        return ms;
+    }, delay);
+    slow.setName("slow").timeBudget(5ms);
+
+    delay.value(1);
+    EXPECT_TRUE(reports.empty());
+
+    delay.value(20);
+    ASSERT_EQ(reports.size(), 1u);
+    EXPECT_EQ(name, "slow");
+    EXPECT_EQ(reports[0].nodeId, slow.getId());
+    EXPECT_GE(reports[0].elapsed, 15ms);
+    EXPECT_GE(reports[0].budget, 4ms);
+    EXPECT_LE(reports[0].budget, 6ms);
+    EXPECT_EQ(reports[0].overruns, 1u);
+    EXPECT_FALSE(reports[0].chronic);
+    EXPECT_EQ(slow.budgetOverruns(), 1u);
+}
+
+// Calcs are not timed unless given a budget, and a zero budget switches the check off
+TEST_F(WatchdogTest, OffByDefault) {
+    int reports = 0;
+    reaction::Watchdog::getInstance().setHandler([&](const reaction::SlowCalcReport &) { ++reports; });
+
+    auto delay = reaction::var(0);
+    auto slow = reaction::calc([](int ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        return ms;
+    }, delay);
+    delay.value(10);
+    EXPECT_EQ(reports, 0);
+    EXPECT_EQ(slow.budgetOverruns(), 0u);
+
+    slow.timeBudget(1ms);
+    delay.value(11);
+    EXPECT_EQ(reports, 1);
+
+    slow.timeBudget(0ns);
+    delay.value(12);
+    EXPECT_EQ(reports, 1);
+    EXPECT_EQ(slow.budgetOverruns(), 1u);
+}
+
+// Reaching the chronic threshold marks the node once and lists it for offloading
+TEST_F(WatchdogTest, MarksChronicOffenders) {
+    auto &watchdog = reaction::Watchdog::getInstance();
+    watchdog.setChronicThreshold(2);
+    int chronicReports = 0;
+    watchdog.setHandler([&](const reaction::SlowCalcReport &report) {
+        if (report.chronic) ++chronicReports;
+    });
+
+    auto tick = reaction::var(0);
+    auto slow = reaction::calc([](int t) {
+        std::this_thread::sleep_for(2ms);
+        return t;
+    }, tick);
+    auto fast = reaction::calc([](int t) { return t + 1; }, tick);
+    slow.timeBudget(1us);
+    fast.timeBudget(1s);
+
+    tick.value(1);
+    EXPECT_FALSE(slow.isChronicallySlow());
+    EXPECT_TRUE(watchdog.chronicOffenders().empty());
+
+    tick.value(2);
+    tick.value(3);
+    EXPECT_TRUE(slow.isChronicallySlow());
+    EXPECT_FALSE(fast.isChronicallySlow());
+    EXPECT_EQ(slow.budgetOverruns(), 3u);
+    EXPECT_EQ(chronicReports, 2);
+    EXPECT_EQ(watchdog.chronicOffenders(), std::vector<uint64_t>{slow.getId()});
+}
+
+// Lazy AdaptiveTrig nodes are timed when a read recomputes them
+TEST_F(WatchdogTest, TimesDeferredRecompute) {
+    int reports = 0;
+    reaction::Watchdog::getInstance().setHandler([&](const reaction::SlowCalcReport &) { ++reports; });
+
+    auto tick = reaction::var(0);
+    bool sleepy = false;
+    auto slow = reaction::calc<reaction::AdaptiveTrig>([&](int t) {
+        if (sleepy) std::this_thread::sleep_for(2ms);
+        return t;
+    }, tick);
+    for (int i = 1; i <= 200; ++i) {
+        tick.value(i);
+    }
+    ASSERT_TRUE(slow.isLazy());
+
+    sleepy = true;
+    slow.timeBudget(1ms);
+    tick.value(201);
+    EXPECT_EQ(reports, 0);
+    EXPECT_EQ(slow.get(), 201);
+    EXPECT_EQ(reports, 1);
+    EXPECT_EQ(slow.budgetOverruns(), 1u);
+}